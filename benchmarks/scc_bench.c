@@ -0,0 +1,605 @@
+/**
+ * @file scc_bench.c
+ * @brief SCC benchmark harness with synthetic graph families
+ *
+ * Generates graphs from several families (R-MAT, Erdos-Renyi G(n,m),
+ * Barabasi-Albert and planted SCCs from the library generators, plus
+ * power-law, long chain, many small cycles and giant SCC with a tail), runs
+ * every algorithm with warmup and repetitions, and writes one JSON
+ * document with wall time, edges/sec and peak RSS per (family, algorithm).
+ * Where Linux perf events are available, each record also carries the
+ * per-run mean of cycles, instructions, LLC/dTLB/branch misses and IPC;
+ * counters the machine refuses are written as null.
+ *
+ * Usage: scc_bench [options]
+ *   --family NAME      rmat, er, ba, planted, powerlaw, chain, cycles, giant
+ *                      or all (default all)
+ *   --scale N          2^N vertices (default 16)
+ *   --edge-factor K    edges per vertex (default 16)
+ *   --reps N           timed repetitions (default 5)
+ *   --warmup N         untimed warmup runs (default 1)
+ *   --seed S           generator seed (default 1)
+ *   --output FILE      JSON destination (default stdout)
+ *   --counters on|off  hardware performance counters (default on)
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "scc.h"
+#include "graph.h"
+#include "scc_algorithms.h"
+#ifdef SCC_ENABLE_PARALLEL
+#include "scc_parallel.h"
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <time.h>
+#include <sys/resource.h>
+#endif
+
+#define BENCH_MAX_REPS 1000
+
+// ---------------------------------------------------------------------------
+// Timing and memory
+// ---------------------------------------------------------------------------
+
+// Monotonic wall clock in milliseconds
+static double bench_now_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+// Reset the peak RSS high-water mark where the OS allows it (Linux
+// /proc/self/clear_refs). Returns false when only the process-wide peak
+// is available.
+static bool bench_reset_peak_rss(void) {
+#ifdef __linux__
+    FILE* file = fopen("/proc/self/clear_refs", "w");
+    if (!file) return false;
+    bool ok = fputs("5", file) >= 0;
+    if (fclose(file) != 0) ok = false;
+    return ok;
+#else
+    return false;
+#endif
+}
+
+// Peak resident set size in bytes (0 if unknown)
+static size_t bench_peak_rss(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+#ifdef __linux__
+    // VmHWM honours clear_refs; ru_maxrss does not
+    FILE* file = fopen("/proc/self/status", "r");
+    if (file) {
+        char line[256];
+        size_t kb = 0;
+        while (fgets(line, sizeof(line), file)) {
+            if (strncmp(line, "VmHWM:", 6) == 0) {
+                kb = (size_t)strtoull(line + 6, NULL, 10);
+                break;
+            }
+        }
+        fclose(file);
+        if (kb > 0) return kb * 1024;
+    }
+#endif
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return (size_t)usage.ru_maxrss;
+#else
+    return (size_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Graph families
+// ---------------------------------------------------------------------------
+
+// SplitMix64: small, fast and good enough for synthetic graphs
+static uint64_t rng_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static int rng_below(uint64_t* state, int bound) {
+    return (int)(rng_next(state) % (uint64_t)bound);
+}
+
+static double rng_unit(uint64_t* state) {
+    return (double)(rng_next(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Edge list under construction; turned into a graph with graph_add_edges_bulk
+typedef struct edge_list {
+    int* src;
+    int* dst;
+    size_t count;
+    size_t capacity;
+} edge_list_t;
+
+static bool edge_list_init(edge_list_t* edges, size_t capacity) {
+    edges->src = malloc(capacity * sizeof(int));
+    edges->dst = malloc(capacity * sizeof(int));
+    edges->count = 0;
+    edges->capacity = capacity;
+    if (!edges->src || !edges->dst) {
+        free(edges->src);
+        free(edges->dst);
+        edges->src = NULL;
+        edges->dst = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void edge_list_push(edge_list_t* edges, int src, int dst) {
+    if (edges->count < edges->capacity) {
+        edges->src[edges->count] = src;
+        edges->dst[edges->count] = dst;
+        edges->count++;
+    }
+}
+
+static graph_t* edge_list_to_graph(edge_list_t* edges, int num_vertices) {
+    graph_t* graph = graph_create(num_vertices);
+    if (graph && (graph_add_vertices(graph, num_vertices) < 0 ||
+                  graph_add_edges_bulk(graph, edges->src, edges->dst, edges->count, 0) < 0)) {
+        graph_destroy(graph);
+        graph = NULL;
+    }
+    free(edges->src);
+    free(edges->dst);
+    return graph;
+}
+
+// Power-law (Chung-Lu): endpoints drawn with probability proportional to
+// (i + 1)^(-1 / (gamma - 1)), gamma = 2.1
+static graph_t* generate_powerlaw(int num_vertices, size_t num_edges, uint64_t seed) {
+    edge_list_t edges;
+    double* cumulative = malloc((size_t)num_vertices * sizeof(double));
+    if (!cumulative || !edge_list_init(&edges, num_edges)) {
+        free(cumulative);
+        return NULL;
+    }
+
+    double exponent = -1.0 / (2.1 - 1.0);
+    double total = 0.0;
+    for (int i = 0; i < num_vertices; i++) {
+        total += pow((double)(i + 1), exponent);
+        cumulative[i] = total;
+    }
+
+    uint64_t state = seed;
+    for (size_t e = 0; e < num_edges; e++) {
+        int endpoint[2];
+        for (int k = 0; k < 2; k++) {
+            double target = rng_unit(&state) * total;
+            int lo = 0, hi = num_vertices - 1;
+            while (lo < hi) {
+                int mid = lo + (hi - lo) / 2;
+                if (cumulative[mid] < target) lo = mid + 1;
+                else hi = mid;
+            }
+            endpoint[k] = lo;
+        }
+        edge_list_push(&edges, endpoint[0], endpoint[1]);
+    }
+
+    free(cumulative);
+    return edge_list_to_graph(&edges, num_vertices);
+}
+
+// Long chain 0 -> 1 -> ... -> n-1: n singleton SCCs and maximal DFS depth
+static graph_t* generate_chain(int num_vertices) {
+    edge_list_t edges;
+    if (!edge_list_init(&edges, (size_t)num_vertices)) return NULL;
+
+    for (int i = 0; i + 1 < num_vertices; i++) {
+        edge_list_push(&edges, i, i + 1);
+    }
+    return edge_list_to_graph(&edges, num_vertices);
+}
+
+// Many small cycles (3..10 vertices) linked forward into a DAG, plus
+// random forward edges up to the requested edge count
+static graph_t* generate_cycles(int num_vertices, size_t num_edges, uint64_t seed) {
+    edge_list_t edges;
+    if (num_edges < (size_t)num_vertices * 2) num_edges = (size_t)num_vertices * 2;
+    if (!edge_list_init(&edges, num_edges)) return NULL;
+
+    uint64_t state = seed;
+    int start = 0;
+    while (start < num_vertices) {
+        int size = 3 + rng_below(&state, 8);
+        if (size > num_vertices - start) size = num_vertices - start;
+        for (int i = 0; i < size; i++) {
+            edge_list_push(&edges, start + i, start + (i + 1) % size);
+        }
+        if (start + size < num_vertices) {
+            edge_list_push(&edges, start, start + size);
+        }
+        start += size;
+    }
+
+    // Forward edges (lower to higher cycle) never merge cycles
+    while (edges.count < num_edges) {
+        int a = rng_below(&state, num_vertices);
+        int b = rng_below(&state, num_vertices);
+        edge_list_push(&edges, a < b ? a : b, a < b ? b : a);
+    }
+    return edge_list_to_graph(&edges, num_vertices);
+}
+
+// One giant SCC over the first 70% of vertices (a Hamiltonian cycle plus
+// random internal edges) and a tail: a forward-only DAG hanging off it
+static graph_t* generate_giant(int num_vertices, size_t num_edges, uint64_t seed) {
+    edge_list_t edges;
+    if (!edge_list_init(&edges, num_edges + (size_t)num_vertices)) return NULL;
+
+    uint64_t state = seed;
+    int giant = num_vertices / 10 * 7;
+    if (giant < 1) giant = 1;
+    for (int i = 0; i < giant; i++) {
+        edge_list_push(&edges, i, (i + 1) % giant);
+    }
+    for (int i = giant; i < num_vertices; i++) {
+        edge_list_push(&edges, rng_below(&state, i), i);
+    }
+
+    while (edges.count < edges.capacity) {
+        int a = rng_below(&state, num_vertices);
+        int b = rng_below(&state, num_vertices);
+        if (a < giant && b < giant) {
+            edge_list_push(&edges, a, b);
+        } else {
+            edge_list_push(&edges, a < b ? a : b, a < b ? b : a);
+        }
+    }
+    return edge_list_to_graph(&edges, num_vertices);
+}
+
+static const char* const family_names[] = {
+    "rmat", "er", "ba", "planted", "powerlaw", "chain", "cycles", "giant"
+};
+#define NUM_FAMILIES (int)(sizeof(family_names) / sizeof(family_names[0]))
+
+// Library generators build a CSR; the linked-list algorithms need a graph_t
+static graph_t* graph_from_generated(csr_graph_t* csr) {
+    graph_t* graph = csr ? graph_from_csr(csr) : NULL;
+    csr_graph_destroy(csr);
+    return graph;
+}
+
+static graph_t* generate_family(int family, int scale, int edge_factor, uint64_t seed) {
+    int num_vertices = 1 << scale;
+    size_t num_edges = (size_t)num_vertices * (size_t)edge_factor;
+    switch (family) {
+        case 0:
+            return graph_from_generated(csr_graph_generate_rmat(scale, (int64_t)num_edges,
+                                                                0.57, 0.19, 0.19, seed, 0));
+        case 1:
+            return graph_from_generated(csr_graph_generate_erdos_renyi(num_vertices,
+                                                                       (int64_t)num_edges, seed, 0));
+        case 2:
+            return graph_from_generated(csr_graph_generate_barabasi_albert(num_vertices,
+                                                                           edge_factor, seed, 0));
+        case 3:
+            // Components of 1..64 vertices (mean ~32): about 2^scale vertices in total
+            return graph_from_generated(csr_graph_generate_planted_scc(num_vertices / 32 + 1, 1, 64,
+                                                                       edge_factor, seed, 0, NULL));
+        case 4: return generate_powerlaw(num_vertices, num_edges, seed);
+        case 5: return generate_chain(num_vertices);
+        case 6: return generate_cycles(num_vertices, num_edges, seed);
+        case 7: return generate_giant(num_vertices, num_edges, seed);
+        default: return NULL;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Algorithms
+// ---------------------------------------------------------------------------
+
+typedef struct bench_algorithm {
+    const char* name;
+    scc_result_t* (*run_graph)(const graph_t* graph);
+    scc_result_t* (*run_csr)(const csr_graph_t* csr);
+} bench_algorithm_t;
+
+#ifdef SCC_ENABLE_PARALLEL
+static scc_result_t* run_parallel(const graph_t* graph) {
+    return scc_find_parallel(graph, NULL);
+}
+
+static scc_result_t* run_parallel_csr(const csr_graph_t* csr) {
+    return scc_find_parallel_csr(csr, NULL);
+}
+#endif
+
+static const bench_algorithm_t algorithms[] = {
+    { "tarjan", scc_find_tarjan, NULL },
+    { "kosaraju", scc_find_kosaraju, NULL },
+    { "tarjan_csr", NULL, scc_find_tarjan_csr },
+    { "kosaraju_csr", NULL, scc_find_kosaraju_csr },
+#ifdef SCC_ENABLE_PARALLEL
+    { "parallel", run_parallel, NULL },
+    { "parallel_csr", NULL, run_parallel_csr },
+#endif
+};
+#define NUM_ALGORITHMS (int)(sizeof(algorithms) / sizeof(algorithms[0]))
+
+static scc_result_t* run_algorithm(const bench_algorithm_t* algorithm,
+                                   const graph_t* graph, const csr_graph_t* csr) {
+    return algorithm->run_graph ? algorithm->run_graph(graph) : algorithm->run_csr(csr);
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Per-run means of the counter totals, null where a counter is unavailable
+static void write_counters(FILE* out, const scc_hw_counters_t* totals, int reps) {
+    fprintf(out, "{");
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        fprintf(out, "%s\"%s\": ", i ? ", " : "", scc_hw_counter_name((scc_hw_counter_t)i));
+        if (totals->valid[i]) {
+            fprintf(out, "%.0f", (double)totals->values[i] / reps);
+        } else {
+            fprintf(out, "null");
+        }
+    }
+
+    fprintf(out, ", \"ipc\": ");
+    if (totals->valid[SCC_HW_CYCLES] && totals->valid[SCC_HW_INSTRUCTIONS] &&
+        totals->values[SCC_HW_CYCLES] > 0) {
+        fprintf(out, "%.3f", (double)totals->values[SCC_HW_INSTRUCTIONS] /
+                             (double)totals->values[SCC_HW_CYCLES]);
+    } else {
+        fprintf(out, "null");
+    }
+    fprintf(out, "}");
+}
+
+// ---------------------------------------------------------------------------
+// Driver
+// ---------------------------------------------------------------------------
+
+typedef struct bench_options {
+    int family;                 // -1 = all
+    int scale;
+    int edge_factor;
+    int reps;
+    int warmup;
+    uint64_t seed;
+    const char* output;
+    bool counters;
+} bench_options_t;
+
+static void print_usage(const char* program) {
+    fprintf(stderr,
+            "Usage: %s [--family rmat|er|ba|planted|powerlaw|chain|cycles|giant|all]\n"
+            "          [--scale N] [--edge-factor K] [--reps N] [--warmup N] [--seed S]\n"
+            "          [--output FILE] [--counters on|off]\n",
+            program);
+}
+
+static bool parse_options(int argc, char** argv, bench_options_t* options) {
+    options->family = -1;
+    options->scale = 16;
+    options->edge_factor = 16;
+    options->reps = 5;
+    options->warmup = 1;
+    options->seed = 1;
+    options->output = NULL;
+    options->counters = true;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!value) return false;
+        i++;
+
+        if (strcmp(arg, "--family") == 0) {
+            options->family = -2;
+            if (strcmp(value, "all") == 0) options->family = -1;
+            for (int f = 0; f < NUM_FAMILIES; f++) {
+                if (strcmp(value, family_names[f]) == 0) options->family = f;
+            }
+            if (options->family == -2) return false;
+        } else if (strcmp(arg, "--scale") == 0) {
+            options->scale = atoi(value);
+        } else if (strcmp(arg, "--edge-factor") == 0) {
+            options->edge_factor = atoi(value);
+        } else if (strcmp(arg, "--reps") == 0) {
+            options->reps = atoi(value);
+        } else if (strcmp(arg, "--warmup") == 0) {
+            options->warmup = atoi(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            options->seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--output") == 0) {
+            options->output = value;
+        } else if (strcmp(arg, "--counters") == 0) {
+            if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) return false;
+            options->counters = strcmp(value, "on") == 0;
+        } else {
+            return false;
+        }
+    }
+
+    return options->scale >= 1 && options->scale <= 30 &&
+           options->edge_factor >= 1 && options->edge_factor <= 1024 &&
+           options->reps >= 1 && options->reps <= BENCH_MAX_REPS &&
+           options->warmup >= 0;
+}
+
+// Benchmark every algorithm on one graph family and append the JSON records
+static bool bench_family(FILE* out, const bench_options_t* options, scc_perf_counters_t* perf,
+                         int family, bool* first_record) {
+    double start = bench_now_ms();
+    graph_t* graph = generate_family(family, options->scale, options->edge_factor, options->seed);
+    double generate_ms = bench_now_ms() - start;
+    if (!graph) {
+        fprintf(stderr, "%s: graph generation failed\n", family_names[family]);
+        return false;
+    }
+
+    start = bench_now_ms();
+    csr_graph_t* csr = graph_freeze(graph);
+    double freeze_ms = bench_now_ms() - start;
+    if (!csr) {
+        graph_destroy(graph);
+        return false;
+    }
+
+    int num_vertices = graph_get_vertex_count(graph);
+    int num_edges = graph_get_edge_count(graph);
+    fprintf(stderr, "%s: %d vertices, %d edges (generated in %.1f ms)\n",
+            family_names[family], num_vertices, num_edges, generate_ms);
+
+    scc_result_t* reference = NULL;
+    bool ok = true;
+    double times[BENCH_MAX_REPS];
+
+    for (int a = 0; a < NUM_ALGORITHMS && ok; a++) {
+        const bench_algorithm_t* algorithm = &algorithms[a];
+
+        for (int w = 0; w < options->warmup; w++) {
+            scc_result_destroy(run_algorithm(algorithm, graph, csr));
+        }
+
+        bool rss_scoped = bench_reset_peak_rss();
+        scc_hw_counters_t counters;
+        memset(&counters, 0, sizeof(counters));
+        scc_result_t* result = NULL;
+        for (int r = 0; r < options->reps && ok; r++) {
+            scc_result_destroy(result);
+            scc_perf_counters_start(perf);
+            start = bench_now_ms();
+            result = run_algorithm(algorithm, graph, csr);
+            times[r] = bench_now_ms() - start;
+            scc_perf_counters_stop(perf, &counters);
+            ok = (result != NULL);
+        }
+        size_t peak_rss = bench_peak_rss();
+        if (!ok) {
+            fprintf(stderr, "%s/%s: algorithm failed\n", family_names[family], algorithm->name);
+            break;
+        }
+
+        bool matches = true;
+        if (!reference) {
+            reference = result;
+        } else {
+            matches = scc_result_equivalent(reference, result);
+        }
+
+        qsort(times, (size_t)options->reps, sizeof(double), compare_double);
+        double sum = 0.0;
+        for (int r = 0; r < options->reps; r++) sum += times[r];
+        double median = (options->reps % 2)
+            ? times[options->reps / 2]
+            : (times[options->reps / 2 - 1] + times[options->reps / 2]) / 2.0;
+        double edges_per_sec = median > 0.0 ? (double)num_edges / (median / 1000.0) : 0.0;
+
+        fprintf(out, "%s\n    {\"family\": \"%s\", \"algorithm\": \"%s\", "
+                "\"vertices\": %d, \"edges\": %d, \"components\": %d, "
+                "\"generate_ms\": %.3f, \"freeze_ms\": %.3f, \"repetitions\": %d, "
+                "\"min_ms\": %.3f, \"median_ms\": %.3f, \"mean_ms\": %.3f, \"max_ms\": %.3f, "
+                "\"edges_per_sec\": %.0f, \"peak_rss_bytes\": %zu, \"peak_rss_scope\": \"%s\", "
+                "\"matches_reference\": %s, \"hw_counters\": ",
+                *first_record ? "" : ",", family_names[family], algorithm->name,
+                num_vertices, num_edges, result->num_components,
+                generate_ms, freeze_ms, options->reps,
+                times[0], median, sum / options->reps, times[options->reps - 1],
+                edges_per_sec, peak_rss, rss_scoped ? "algorithm" : "process",
+                matches ? "true" : "false");
+        write_counters(out, &counters, options->reps);
+        fprintf(out, "}");
+        *first_record = false;
+
+        fprintf(stderr, "  %-14s median %10.3f ms  %12.0f edges/s%s\n",
+                algorithm->name, median, edges_per_sec, matches ? "" : "  MISMATCH");
+        if (!matches) ok = false;
+        if (result != reference) scc_result_destroy(result);
+    }
+
+    scc_result_destroy(reference);
+    csr_graph_destroy(csr);
+    graph_destroy(graph);
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    bench_options_t options;
+    if (!parse_options(argc, argv, &options)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    FILE* out = options.output ? fopen(options.output, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot open %s\n", options.output);
+        return 1;
+    }
+
+    // Without perf events the records just carry null counters
+    scc_perf_counters_t* perf = options.counters ? scc_perf_counters_open() : NULL;
+    if (options.counters && !perf) {
+        fprintf(stderr, "hardware counters unavailable; continuing without them\n");
+    }
+
+    fprintf(out, "{\n  \"benchmark\": \"scc_bench\",\n");
+    fprintf(out, "  \"config\": {\"scale\": %d, \"edge_factor\": %d, \"reps\": %d, "
+            "\"warmup\": %d, \"seed\": %llu, \"parallel\": %s, \"hw_counters\": %s},\n",
+            options.scale, options.edge_factor, options.reps, options.warmup,
+            (unsigned long long)options.seed,
+#ifdef SCC_ENABLE_PARALLEL
+            "true",
+#else
+            "false",
+#endif
+            perf ? "true" : "false");
+    fprintf(out, "  \"results\": [");
+
+    bool ok = true;
+    bool first_record = true;
+    for (int f = 0; f < NUM_FAMILIES; f++) {
+        if (options.family == -1 || options.family == f) {
+            ok = bench_family(out, &options, perf, f, &first_record) && ok;
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) fclose(out);
+    scc_perf_counters_close(perf);
+    return ok ? 0 : 1;
+}
@@ -3,53 +3,198 @@
 
 #include "scc.h"
 #include <stdbool.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// Memory pool for efficient allocation
-typedef struct memory_block {
-    void* data;
-    size_t size;
-    bool is_free;
-    struct memory_block* next;
-} memory_block_t;
+// Fixed-size slab allocator
+// Every object has the same size (block_size rounded up to the alignment).
+// Objects are carved from large chunks with a bump pointer, and freed objects
+// are threaded onto an intrusive free list, so alloc and free are O(1) and
+// destroying the pool costs one free() per chunk.
+typedef struct memory_chunk {
+    struct memory_chunk* next;
+    size_t capacity;            // Objects in this chunk
+} memory_chunk_t;
 
 typedef struct memory_pool {
-    memory_block_t* blocks;
-    size_t block_size;
-    size_t total_allocated;
-    size_t total_used;
+    void* free_list;            // Freed objects; the first word links to the next
+    memory_chunk_t* chunks;     // Newest chunk first
+    char* bump;                 // Next never-used object in the newest chunk
+    char* bump_end;
+    size_t block_size;          // Object (slot) size
     size_t alignment;
+    size_t next_chunk_capacity; // Objects in the next chunk (grows geometrically)
+    size_t total_allocated;     // Bytes of object storage in all chunks
+    size_t total_used;          // Bytes in live objects
 } memory_pool_t;
 
-// Graph creation with custom memory pools
-graph_t* graph_create_with_pools(int initial_capacity, 
-                                 memory_pool_t* vertex_pool,
-                                 memory_pool_t* edge_pool);
+// Graph creation with a caller-owned (shareable) edge pool
+graph_t* graph_create_with_edge_pool(int initial_capacity, memory_pool_t* edge_pool);
 
 // Memory pool functions
+// memory_pool_alloc fails for sizes above block_size; free and reset only
+// recycle objects, memory returns to the system in memory_pool_destroy
 memory_pool_t* memory_pool_create(size_t block_size, size_t alignment);
 void memory_pool_destroy(memory_pool_t* pool);
 void* memory_pool_alloc(memory_pool_t* pool, size_t size);
 void memory_pool_free(memory_pool_t* pool, void* ptr);
 void memory_pool_reset(memory_pool_t* pool);
+int memory_pool_reserve(memory_pool_t* pool, size_t count);
+
+// Vertices with at least this many out-edges get an open-addressing hash
+// index (dest -> list link), making graph_has_edge, graph_add_edge and
+// graph_remove_edge expected O(1) on hubs instead of O(degree)
+#define GRAPH_EDGE_INDEX_MIN_DEGREE 32
+
+// Bulk edge insertion: adds src[i] -> dst[i] for i < n in one pass.
+// All endpoints are validated before anything is added. Duplicates (within
+// the batch or against existing edges) are skipped unless the caller passes
+// GRAPH_BULK_ASSUME_UNIQUE. Returns the number of edges added, or a negative
+// error code (after an allocation failure the edges added so far remain).
+#define GRAPH_BULK_ASSUME_UNIQUE 0x1u
+
+int graph_add_edges_bulk(graph_t* graph, const int* src, const int* dst,
+                         size_t n, unsigned int flags);
 
 // Advanced graph operations
 int graph_resize(graph_t* graph, int new_capacity);
 graph_t* graph_copy(const graph_t* graph);
 graph_t* graph_transpose(const graph_t* graph);
 
+// CSR graph operations
+csr_graph_t* csr_graph_create(int num_vertices, int64_t num_edges);
+csr_graph_t* csr_graph_transpose(const csr_graph_t* csr);
+csr_graph_t* graph_transpose_csr(const graph_t* graph);
+
+// Fill a preallocated transpose (offsets: num_vertices + 1, targets: num_edges)
+void csr_graph_transpose_fill(const csr_graph_t* csr, csr_graph_t* transpose);
+void graph_transpose_csr_fill(const graph_t* graph, csr_graph_t* transpose);
+int csr_graph_get_out_degree(const csr_graph_t* csr, int vertex);
+
+// Sort each vertex's targets and drop duplicates in place, compacting the
+// target array (OpenMP; num_threads 0 = default). Not for mapped CSRs.
+int csr_graph_sort_targets(csr_graph_t* csr, int num_threads);
+
 // Graph I/O functions
 typedef enum {
     GRAPH_FORMAT_EDGE_LIST,
     GRAPH_FORMAT_ADJACENCY_LIST,
     GRAPH_FORMAT_MATRIX,
-    GRAPH_FORMAT_DOT
+    GRAPH_FORMAT_DOT,
+    GRAPH_FORMAT_BINARY         // Versioned page-aligned CSR (see csr_graph_save_binary)
 } graph_format_t;
 
+// filename "-" reads standard input through graph_load_from_stream
 int graph_load_from_file(graph_t** graph, const char* filename, graph_format_t format);
+
+// Single-pass loader for non-seekable input (pipes, stdin, decompressors).
+// Supports GRAPH_FORMAT_EDGE_LIST and GRAPH_FORMAT_ADJACENCY_LIST; the vertex
+// count grows with the largest ID seen, so no rewind is needed.
+int graph_load_from_stream(graph_t** graph, FILE* stream, graph_format_t format);
+
+// Memory-mapped edge-list loader: the file is split into newline-aligned
+// chunks that are parsed in parallel (OpenMP; num_threads 0 = default) and
+// fed straight into a CSR. Same format as GRAPH_FORMAT_EDGE_LIST; each
+// vertex's targets come out sorted with duplicates removed.
+csr_graph_t* csr_graph_load_edge_list(const char* filename, int num_threads);
+
+// Streaming counterpart of csr_graph_load_edge_list: reads the stream once
+// in fixed-size blocks, so it works on pipes and standard input
+csr_graph_t* csr_graph_read_edge_list(FILE* stream);
+
+// External ID map: dense internal IDs 0..count-1 for arbitrary 64-bit
+// external IDs, assigned in order of first appearance. Slots hold only the
+// internal ID (keys are compared through external_ids), keeping the table
+// at 4 bytes per slot; external_ids doubles as the reverse mapping.
+typedef struct scc_id_map {
+    int* slots;                 // Open addressing, linear probing; -1 = empty
+    uint64_t* external_ids;     // Internal ID -> external ID
+    size_t mask;                // Slot count - 1 (power of two)
+    int count;
+    int capacity;               // Entries allocated in external_ids
+} scc_id_map_t;
+
+scc_id_map_t* scc_id_map_create(size_t expected_ids);
+void scc_id_map_destroy(scc_id_map_t* map);
+int scc_id_map_get_or_add(scc_id_map_t* map, uint64_t external_id);
+int scc_id_map_find(const scc_id_map_t* map, uint64_t external_id);     // -1 if absent
+uint64_t scc_id_map_external(const scc_id_map_t* map, int internal_id);
+int scc_id_map_count(const scc_id_map_t* map);
+
+// Edge-list loaders for sparse or 64-bit vertex IDs: every ID in the file
+// (unsigned decimal, up to 2^64 - 1) is mapped to a dense internal ID, so
+// memory depends on the number of distinct IDs, not the largest one.
+// On success *id_map receives the mapping (caller destroys it) for
+// reporting results in external IDs.
+csr_graph_t* csr_graph_load_edge_list_remap(const char* filename, int num_threads,
+                                            scc_id_map_t** id_map);
+int graph_load_edge_list_remap(graph_t** graph, const char* filename, scc_id_map_t** id_map);
+
+// Linked-list graph with the same edges as the CSR (adjacency order kept)
+graph_t* graph_from_csr(const csr_graph_t* csr);
+
+// Synthetic graph generators. Every random draw is a pure function of
+// (seed, edge index), so the same seed gives the same graph for any thread
+// count (OpenMP; num_threads 0 = default). The CSR is filled by a counting
+// pass and a scatter pass that regenerate each edge, without an
+// intermediate edge list; targets come out sorted with duplicates removed,
+// so the edge count can fall slightly below the number of draws. The
+// graph_generate_* variants return the same graph as a graph_t (at most
+// INT_MAX edges).
+//
+// Erdos-Renyi G(n, m): num_edges uniform draws without self-loops
+csr_graph_t* csr_graph_generate_erdos_renyi(int num_vertices, int64_t num_edges,
+                                            uint64_t seed, int num_threads);
+graph_t* graph_generate_erdos_renyi(int num_vertices, int num_edges, uint64_t seed);
+
+// R-MAT on 2^scale vertices (scale <= 30) with quadrant probabilities a, b,
+// c and d = 1 - a - b - c (Graph500 uses 0.57, 0.19, 0.19). Vertex IDs are
+// scrambled by a seeded bijection so hubs are not clustered at low IDs;
+// self-loops are kept as in Graph500.
+csr_graph_t* csr_graph_generate_rmat(int scale, int64_t num_edges, double a, double b,
+                                     double c, uint64_t seed, int num_threads);
+graph_t* graph_generate_rmat(int scale, int num_edges, double a, double b, double c,
+                             uint64_t seed);
+
+// Barabasi-Albert preferential attachment: every vertex after the first
+// attaches edges_per_vertex edges to earlier vertices chosen in proportion
+// to their degree. Each edge is oriented at random (an all-backward
+// orientation would be acyclic), giving a power-law graph with a giant SCC.
+csr_graph_t* csr_graph_generate_barabasi_albert(int num_vertices, int edges_per_vertex,
+                                                uint64_t seed, int num_threads);
+graph_t* graph_generate_barabasi_albert(int num_vertices, int edges_per_vertex,
+                                        uint64_t seed);
+
+// Planted SCCs with known ground truth: num_components components with
+// sizes drawn from [min_size, max_size], each a directed cycle plus random
+// internal edges, joined by edges that only go from lower- to
+// higher-numbered components. Each vertex has about edges_per_vertex
+// out-edges. Vertex IDs are shuffled by a seeded bijection. If
+// ground_truth is non-NULL it receives the exact partition (component c is
+// the c-th planted component, so numbering is topological); the caller
+// destroys it.
+csr_graph_t* csr_graph_generate_planted_scc(int num_components, int min_size, int max_size,
+                                            int edges_per_vertex, uint64_t seed,
+                                            int num_threads, scc_result_t** ground_truth);
+graph_t* graph_generate_planted_scc(int num_components, int min_size, int max_size,
+                                    int edges_per_vertex, uint64_t seed,
+                                    scc_result_t** ground_truth);
+
+// Native binary CSR format: a versioned header followed by the offsets
+// (int64, V + 1) and targets (int32, E) sections, each starting on a
+// 4096-byte boundary. Files are written in host byte order and rejected
+// on a mismatch. csr_graph_map_binary maps the file and points the CSR at
+// it without copying or parsing, so load time is independent of graph
+// size; the header is checked but section contents are trusted.
+int csr_graph_save_binary(const csr_graph_t* csr, const char* filename);
+csr_graph_t* csr_graph_map_binary(const char* filename);
+
+// Read-only whole-file mapping (read into memory where mmap is unavailable)
+int scc_map_file(const char* filename, const void** data, size_t* size);
+void scc_unmap_file(const void* data, size_t size);
 int graph_save_to_file(const graph_t* graph, const char* filename, graph_format_t format);
 
 // Graph traversal utilities
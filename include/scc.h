@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,8 +23,9 @@ typedef enum {
 
 // Forward declarations
 typedef struct graph graph_t;
+typedef struct csr_graph csr_graph_t;
 typedef struct scc_result scc_result_t;
-typedef struct scc_component scc_component_t;
+typedef struct scc_context scc_context_t;
 
 // Graph data structures
 typedef struct edge {
@@ -31,54 +33,74 @@ typedef struct edge {
     struct edge* next;
 } edge_t;
 
+// Vertices carry no algorithm state: every algorithm keeps its per-run
+// index/lowlink/visited data in its own arrays, so a const graph can be
+// analysed from several threads at once
 typedef struct vertex {
-    int id;
     edge_t* edges;
+    int id;
     int out_degree;
     
-    // Algorithm-specific fields
-    int index;
-    int lowlink;
-    bool on_stack;
-    bool visited;
+    // Hash index over the edge list, built once out_degree reaches
+    // GRAPH_EDGE_INDEX_MIN_DEGREE (NULL for low-degree vertices)
+    struct edge_index* edge_index;
     
     // User data
     void* data;
 } vertex_t;
 
 typedef struct graph {
-    vertex_t** vertices;
+    vertex_t* vertices;         // Stored inline, indexed by vertex id
     int num_vertices;
     int num_edges;
     int capacity;
     
-    // Memory management
-    struct memory_pool* vertex_pool;
+    // Memory management: edges come from this slab pool. A pool created by
+    // graph_create is owned and released wholesale in graph_destroy; a pool
+    // passed to graph_create_with_edge_pool is not.
     struct memory_pool* edge_pool;
+    bool owns_edge_pool;
 } graph_t;
 
-// SCC result structures
-typedef struct scc_component {
-    int* vertices;
-    int size;
-    int capacity;
-} scc_component_t;
-
+// Frozen (immutable) compressed-sparse-row graph
+// Out-neighbours of v are targets[offsets[v]] .. targets[offsets[v + 1] - 1]
+typedef struct csr_graph {
+    int num_vertices;
+    int64_t num_edges;
+    int64_t* offsets;   // num_vertices + 1 entries
+    int* targets;       // num_edges entries
+    
+    // Non-NULL when offsets/targets point into a read-only file mapping
+    // (csr_graph_map_binary); the arrays must not be modified or freed
+    const void* mapping;
+    size_t mapping_size;
+} csr_graph_t;
+
+// SCC result structure (flat layout)
+// Members of component c are vertices[component_offsets[c]] .. vertices[component_offsets[c + 1] - 1]
 typedef struct scc_result {
-    scc_component_t* components;
+    int* vertices;             // Permutation of all vertices, grouped by component
+    int* component_offsets;    // num_components + 1 entries
     int num_components;
+    int num_vertices;
     int* vertex_to_component;
     
     // Statistics
     int largest_component_size;
     int smallest_component_size;
     double average_component_size;
+    
+    // Non-NULL when the arrays point into a read-only file mapping
+    // (scc_result_load); the arrays must not be modified or freed
+    const void* mapping;
+    size_t mapping_size;
 } scc_result_t;
 
 // Graph management functions
 graph_t* graph_create(int initial_capacity);
 void graph_destroy(graph_t* graph);
 int graph_add_vertex(graph_t* graph);
+int graph_add_vertices(graph_t* graph, int count);  // Returns the first new id, or -1
 int graph_add_edge(graph_t* graph, int src, int dest);
 int graph_remove_edge(graph_t* graph, int src, int dest);
 bool graph_has_edge(const graph_t* graph, int src, int dest);
@@ -86,15 +108,80 @@ int graph_get_out_degree(const graph_t* graph, int vertex);
 int graph_get_vertex_count(const graph_t* graph);
 int graph_get_edge_count(const graph_t* graph);
 
+// Frozen CSR graph functions
+csr_graph_t* graph_freeze(const graph_t* graph);
+void csr_graph_destroy(csr_graph_t* csr);
+
 // SCC computation functions
 scc_result_t* scc_find_tarjan(const graph_t* graph);
 scc_result_t* scc_find_kosaraju(const graph_t* graph);
 scc_result_t* scc_find(const graph_t* graph);  // Default algorithm
 
+// SCC computation on frozen CSR graphs
+scc_result_t* scc_find_tarjan_csr(const csr_graph_t* csr);
+scc_result_t* scc_find_kosaraju_csr(const csr_graph_t* csr);
+
+// Per-phase statistics for one SCC run
+// Recorded only when the library is built with SCC_ENABLE_PROFILING. In other
+// builds the instrumentation is compiled out, the *_stats functions run at
+// full speed and leave the struct zeroed with enabled == false. Phases an
+// algorithm does not have stay 0. Allocation counters cover every library
+// allocation made during the call, including those of other threads.
+typedef struct scc_stats {
+    bool enabled;
+    
+    // Wall time per phase, in milliseconds (monotonic clock)
+    double tarjan_dfs_ms;            // Component extraction included
+    double kosaraju_first_pass_ms;
+    double transpose_ms;
+    double kosaraju_second_pass_ms;  // Assigns components as it goes
+    double statistics_ms;
+    double total_ms;                 // Whole call, state setup and teardown included
+    
+    // Work counters
+    int64_t edges_scanned;
+    int64_t stack_pushes;            // DFS frames pushed, in all passes
+    int64_t vertices_extracted;      // Tarjan: vertices popped into components
+    int max_dfs_depth;
+    int64_t allocations;             // scc_malloc/scc_calloc/scc_realloc calls
+    int64_t bytes_allocated;         // Bytes requested (growth only for realloc)
+} scc_stats_t;
+
+// Same as the functions above; stats may be NULL
+scc_result_t* scc_find_tarjan_stats(const graph_t* graph, scc_stats_t* stats);
+scc_result_t* scc_find_kosaraju_stats(const graph_t* graph, scc_stats_t* stats);
+scc_result_t* scc_find_tarjan_csr_stats(const csr_graph_t* csr, scc_stats_t* stats);
+scc_result_t* scc_find_kosaraju_csr_stats(const csr_graph_t* csr, scc_stats_t* stats);
+
+// Reusable workspace for repeated SCC runs
+// The context owns the algorithm stacks, per-vertex arrays, transpose and
+// result buffers. They only grow, so once the context has seen the largest
+// graph a recomputation performs no heap allocation. The returned result is
+// owned by the context and stays valid until the next call on it.
+scc_context_t* scc_context_create(int initial_capacity);
+void scc_context_destroy(scc_context_t* ctx);
+const scc_result_t* scc_find_tarjan_ctx(const graph_t* graph, scc_context_t* ctx);
+const scc_result_t* scc_find_kosaraju_ctx(const graph_t* graph, scc_context_t* ctx);
+const scc_result_t* scc_find_tarjan_csr_ctx(const csr_graph_t* csr, scc_context_t* ctx);
+const scc_result_t* scc_find_kosaraju_csr_ctx(const csr_graph_t* csr, scc_context_t* ctx);
+
 // Result management
 void scc_result_destroy(scc_result_t* result);
 scc_result_t* scc_result_copy(const scc_result_t* result);
 
+// True when both results group the vertices identically, whatever the
+// component numbering (O(V): each side is relabelled in first-seen order)
+bool scc_result_equivalent(const scc_result_t* a, const scc_result_t* b);
+
+// Binary result file: a versioned header followed by vertex_to_component
+// (int32, V), component_offsets (int32, C + 1) and the grouped vertices
+// (int32, V), each section on a 4096-byte boundary in host byte order.
+// scc_result_load maps the file and uses the arrays in place, so another
+// process can answer component lookups without recomputing or parsing;
+// only the header is validated, section contents are trusted.
+int scc_result_save(const scc_result_t* result, const char* filename);
+scc_result_t* scc_result_load(const char* filename);
+
 // Result analysis functions
 int scc_get_component_count(const scc_result_t* result);
 int scc_get_component_size(const scc_result_t* result, int component_id);
@@ -106,10 +193,24 @@ bool scc_is_strongly_connected(const graph_t* graph);
 graph_t* scc_build_condensation_graph(const graph_t* graph, const scc_result_t* scc);
 
 // Utility functions
+void scc_set_error(scc_error_t error);
 const char* scc_error_string(scc_error_t error);
 int scc_get_last_error(void);
 void scc_clear_error(void);
 
+// Instrumented heap allocator behind every library allocation. Each block
+// carries a 16-byte size header, so the live byte count is exact and the
+// process-wide peak can be measured around an operation: reset it to the
+// current value, run, then read it. Blocks from scc_malloc/scc_calloc/
+// scc_realloc must be released with scc_free.
+void* scc_malloc(size_t size);
+void* scc_calloc(size_t count, size_t size);
+void* scc_realloc(void* ptr, size_t size);
+void scc_free(void* ptr);
+size_t scc_memory_current_bytes(void);
+size_t scc_memory_peak_bytes(void);
+void scc_memory_reset_peak(void);     // Peak := current
+
 // Statistics functions
 void scc_print_statistics(const scc_result_t* result);
 void scc_print_components(const scc_result_t* result);
@@ -9,18 +9,44 @@ extern "C" {
 
 // Algorithm-specific state structures
 
+// Explicit DFS call-stack frame used by the iterative CSR kernels
+typedef struct dfs_frame {
+    int vertex;
+    int64_t next_edge;  // Cursor into csr->targets
+} dfs_frame_t;
+
+// Explicit DFS call-stack frame used by the iterative adjacency-list kernels
+typedef struct edge_frame {
+    int vertex;
+    const edge_t* next_edge;  // Cursor into the vertex's edge list
+} edge_frame_t;
+
 // Tarjan's algorithm state
 typedef struct tarjan_state {
     int* stack;
     int stack_top;
     int stack_capacity;
     int current_index;
+    int max_depth;          // Deepest DFS path of the last run, in frames
+    scc_stats_t* stats;     // Phase statistics sink, NULL when not requested
     
     scc_result_t* result;
     int current_component;
     
     // Temporary arrays for algorithm state
     bool* vertices_processed;
+    
+    // Per-vertex arrays (sized for vertex_capacity vertices)
+    int vertex_capacity;
+    int* index;
+    int* lowlink;
+    bool* on_stack;
+    
+    // DFS call stacks, kept across runs on the same state
+    dfs_frame_t* frames;
+    int frame_capacity;
+    edge_frame_t* edge_frames;
+    int edge_frame_capacity;
 } tarjan_state_t;
 
 // Kosaraju's algorithm state  
@@ -28,7 +54,7 @@ typedef struct kosaraju_state {
     int* finish_order;
     int finish_index;
     int finish_capacity;
-    graph_t* transpose_graph;
+    scc_stats_t* stats;     // Phase statistics sink, NULL when not requested
     
     scc_result_t* result;
     int current_component;
@@ -36,18 +62,77 @@ typedef struct kosaraju_state {
     // DFS state
     bool* visited_first_pass;
     bool* visited_second_pass;
+    
+    // Reverse adjacency (flat arrays) used by the second pass, kept across runs
+    csr_graph_t* transpose_csr;
+    int transpose_vertex_capacity;
+    int64_t transpose_edge_capacity;
+    
+    // DFS call stacks
+    dfs_frame_t* frames;
+    int frame_capacity;
+    edge_frame_t* edge_frames;
+    int edge_frame_capacity;
 } kosaraju_state_t;
 
+// Reusable workspace behind scc_find_*_ctx; states are created on first use
+struct scc_context {
+    tarjan_state_t* tarjan;
+    kosaraju_state_t* kosaraju;
+    scc_result_t* result;      // Shared by both algorithms, owned by the context
+    int result_capacity;
+    int initial_capacity;
+};
+
+// Result construction helpers used by the algorithm implementations
+scc_result_t* scc_result_create(int num_vertices);
+void scc_result_compute_statistics(scc_result_t* result);
+
 // Algorithm state management
 tarjan_state_t* tarjan_state_create(int num_vertices);
 void tarjan_state_destroy(tarjan_state_t* state);
+int tarjan_state_reserve(tarjan_state_t* state, int num_vertices);
 
 kosaraju_state_t* kosaraju_state_create(int num_vertices);
 void kosaraju_state_destroy(kosaraju_state_t* state);
+int kosaraju_state_reserve(kosaraju_state_t* state, int num_vertices);
 
 // Core algorithm implementations
 scc_result_t* scc_tarjan_internal(const graph_t* graph, tarjan_state_t* state);
 scc_result_t* scc_kosaraju_internal(const graph_t* graph, kosaraju_state_t* state);
+scc_result_t* scc_tarjan_csr_internal(const csr_graph_t* csr, tarjan_state_t* state);
+scc_result_t* scc_kosaraju_csr_internal(const csr_graph_t* csr, kosaraju_state_t* state);
+
+// Instrumentation behind scc_stats_t
+// Without SCC_ENABLE_PROFILING every macro expands to nothing, so the kernels
+// compile exactly as they would without it. Kernels count into locals and
+// flush them once per DFS, and phases are timed only when a sink is attached.
+#ifdef SCC_ENABLE_PROFILING
+#define SCC_PROFILE(...) __VA_ARGS__
+#define SCC_PHASE_START(stats, start) double start = (stats) ? scc_profile_clock_ms() : 0.0
+#define SCC_PHASE_STOP(stats, field, start) \
+    do { if (stats) (stats)->field += scc_profile_clock_ms() - (start); } while (0)
+#else
+#define SCC_PROFILE(...)
+#define SCC_PHASE_START(stats, start) ((void)0)
+#define SCC_PHASE_STOP(stats, field, start) ((void)0)
+#endif
+
+// Totals of the instrumented allocator at the start of a profiled call
+typedef struct scc_profile_run {
+    double start_ms;
+    int64_t allocations;
+    int64_t bytes_allocated;
+} scc_profile_run_t;
+
+double scc_profile_clock_ms(void);  // Monotonic wall clock
+void scc_profile_begin(scc_profile_run_t* run, scc_stats_t* stats);
+void scc_profile_end(scc_profile_run_t* run, scc_stats_t* stats);
+void scc_profile_add_dfs(scc_stats_t* stats, int64_t edges_scanned, int64_t stack_pushes, int max_depth);
+
+// Running totals of allocation calls and bytes (0 without SCC_ENABLE_PROFILING)
+int64_t scc_memory_allocation_count(void);
+int64_t scc_memory_allocated_bytes(void);
 
 // Algorithm-specific utility functions
 void tarjan_dfs(const graph_t* graph, int vertex, tarjan_state_t* state);
@@ -61,20 +146,61 @@ bool tarjan_stack_contains(const tarjan_state_t* state, int vertex);
 bool tarjan_stack_is_empty(const tarjan_state_t* state);
 
 // Incremental/Dynamic SCC support
+
+// Sort key used when reordering slots or components by label
+typedef struct scc_order_entry {
+    int64_t label;
+    int id;
+} scc_order_entry_t;
+
+// Components are kept in a dynamic topological order of the condensation
+// (Pearce-Kelly): every edge between two components goes from a lower to a
+// higher order label. An inserted edge that agrees with the order costs O(1);
+// one that contradicts it searches only the components whose labels lie
+// between its endpoints, merges those that now form a cycle and reorders the
+// rest. Removing an edge inside a component re-runs Tarjan on that component
+// only and splices the pieces into its place in the order. Component ids in
+// the result follow the order at the last rebuild.
 typedef struct scc_incremental {
     graph_t* graph;
-    scc_result_t* current_result;
-    bool needs_recomputation;
-    
-    // Change tracking
-    struct {
-        int* added_edges_src;
-        int* added_edges_dest;
-        int num_added_edges;
-        int capacity;
-    } changes;
-    
-    // Algorithm preference
+    graph_t* reverse;              // Predecessor lists for the backward search
+    scc_result_t* current_result;  // Cached result, rebuilt lazily
+    bool needs_recomputation;      // current_result no longer matches the graph
+    
+    int num_vertices;              // Vertices known to the component structure
+    int vertex_capacity;
+    
+    // Components are named by a representative vertex
+    int* vertex_component;         // vertex -> representative
+    int* next_member;              // Member list link, -1 terminates
+    int* component_head;           // Indexed by representative
+    int* component_tail;
+    int* component_size;
+    int* component_slot;           // Position of the component in the order
+    
+    // Topological order as a doubly linked list of labelled slots
+    int64_t* slot_label;
+    int* slot_prev;
+    int* slot_next;
+    int* slot_component;
+    int order_head;
+    int order_tail;
+    int num_slots;                 // Slots handed out so far
+    int* free_slots;
+    int num_free_slots;
+    
+    // Search scratch space
+    int* forward_mark;             // Indexed by representative, compared to search_epoch
+    int* backward_mark;
+    int search_epoch;
+    int* search_stack;
+    int* forward_list;
+    int* backward_list;
+    int* merge_list;
+    int* local_index;              // vertex -> position inside a component being split
+    scc_order_entry_t* order_scratch;
+    
+    // Algorithm used by scc_incremental_force_recompute
     enum {
         SCC_INCREMENTAL_TARJAN,
         SCC_INCREMENTAL_KOSARAJU,
@@ -86,6 +212,8 @@ typedef struct scc_incremental {
 scc_incremental_t* scc_incremental_create(int initial_capacity);
 void scc_incremental_destroy(scc_incremental_t* scc_inc);
 
+int scc_incremental_add_vertex(scc_incremental_t* scc_inc);
+
 int scc_incremental_add_edge(scc_incremental_t* scc_inc, int src, int dest);
 int scc_incremental_remove_edge(scc_incremental_t* scc_inc, int src, int dest);
 const scc_result_t* scc_incremental_get_result(scc_incremental_t* scc_inc);
@@ -93,32 +221,78 @@ const scc_result_t* scc_incremental_get_result(scc_incremental_t* scc_inc);
 void scc_incremental_force_recompute(scc_incremental_t* scc_inc);
 bool scc_incremental_needs_update(const scc_incremental_t* scc_inc);
 
-// Parallel SCC support (future extension)
+// Parallel SCC support
 #ifdef SCC_ENABLE_PARALLEL
-typedef struct scc_parallel_config {
-    int num_threads;
-    int chunk_size;
-    bool use_work_stealing;
-} scc_parallel_config_t;
-
-scc_result_t* scc_find_parallel(const graph_t* graph, const scc_parallel_config_t* config);
+#include "scc_parallel.h"
 #endif
 
+// Hardware performance counters (Linux perf_event_open)
+// Each event is opened on its own, so counters the CPU, hypervisor or
+// perf_event_paranoid setting refuses are simply marked invalid. They count
+// user-mode events of the calling thread and of threads it creates later;
+// pool threads that already exist (e.g. OpenMP workers) are not included.
+typedef enum {
+    SCC_HW_CYCLES,
+    SCC_HW_INSTRUCTIONS,
+    SCC_HW_LLC_MISSES,          // Last-level cache read misses
+    SCC_HW_DTLB_MISSES,         // Data TLB read misses
+    SCC_HW_BRANCH_MISSES,
+    SCC_HW_COUNTER_COUNT
+} scc_hw_counter_t;
+
+typedef struct scc_hw_counters {
+    uint64_t values[SCC_HW_COUNTER_COUNT];
+    bool valid[SCC_HW_COUNTER_COUNT];   // false: unsupported or not permitted
+} scc_hw_counters_t;
+
+typedef struct scc_perf_counters scc_perf_counters_t;
+
+// NULL when no counter can be opened (other platforms, no permission);
+// the functions below accept NULL and then measure nothing
+scc_perf_counters_t* scc_perf_counters_open(void);
+void scc_perf_counters_close(scc_perf_counters_t* counters);
+void scc_perf_counters_start(scc_perf_counters_t* counters);
+void scc_perf_counters_stop(scc_perf_counters_t* counters, scc_hw_counters_t* sample);  // Adds to sample
+const char* scc_hw_counter_name(scc_hw_counter_t counter);
+
 // Algorithm benchmarking and profiling
+// Each algorithm runs once untimed, then `repetitions` times under a
+// monotonic wall clock. Memory is the peak of the library's instrumented
+// allocator during a run, above what was live before it (working state,
+// transpose and result included); concurrent allocations by other threads
+// would be counted too.
+#define SCC_BENCHMARK_DEFAULT_REPETITIONS 5
+
+typedef struct scc_timing_stats {
+    double min_ms;
+    double median_ms;
+    double p99_ms;          // Nearest-rank 99th percentile
+    double mean_ms;
+    double max_ms;
+} scc_timing_stats_t;
+
 typedef struct scc_benchmark_result {
-    double tarjan_time_ms;
+    double tarjan_time_ms;      // Median wall time
     double kosaraju_time_ms;
+    scc_timing_stats_t tarjan_timing;
+    scc_timing_stats_t kosaraju_timing;
+    int repetitions;
     
     size_t tarjan_memory_peak_bytes;
     size_t kosaraju_memory_peak_bytes;
     
-    int tarjan_stack_max_depth;
+    // Totals over the timed repetitions; all invalid without perf events
+    scc_hw_counters_t tarjan_counters;
+    scc_hw_counters_t kosaraju_counters;
+    
+    int tarjan_stack_max_depth;     // Deepest DFS path, in explicit frames
     int kosaraju_transpose_edges;
     
-    bool results_match;  // Verify algorithms produce same result
+    bool results_match;  // Same partition (scc_result_equivalent)
 } scc_benchmark_result_t;
 
 scc_benchmark_result_t* scc_benchmark_algorithms(const graph_t* graph);
+scc_benchmark_result_t* scc_benchmark_algorithms_repeat(const graph_t* graph, int repetitions);
 void scc_benchmark_result_destroy(scc_benchmark_result_t* benchmark);
 
 // Algorithm selection heuristics
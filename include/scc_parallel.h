@@ -0,0 +1,40 @@
+#ifndef SCC_PARALLEL_H
+#define SCC_PARALLEL_H
+
+#include "scc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Parallel SCC engine (Forward-Backward with trimming, OpenMP)
+//
+// 1. Trim: vertices with no in- or out-neighbour left are singleton SCCs
+// 2. Peel: parallel forward/backward BFS from a high-degree pivot; the
+//    intersection is one SCC (usually the giant one)
+// 3. Recurse: the remaining partitions (F\S, B\S, rest) are processed as
+//    independent tasks, splitting again with FW-BW until they are small
+//    enough for sequential Tarjan
+//
+// The result holds the same partition as Tarjan, numbered canonically:
+// components are ordered by their smallest vertex and vertices inside a
+// component are ascending, so the output is identical for any thread count.
+// scc_find() stays sequential, so its numbering never depends on graph size;
+// call scc_find_parallel explicitly to use this engine.
+
+typedef struct scc_parallel_config {
+    int num_threads;          // 0 = OpenMP default
+    int chunk_size;           // Loop scheduling chunk; 0 = default
+    bool use_work_stealing;   // Dynamic scheduling for loops instead of static
+} scc_parallel_config_t;
+
+scc_parallel_config_t scc_parallel_config_default(void);
+
+scc_result_t* scc_find_parallel(const graph_t* graph, const scc_parallel_config_t* config);
+scc_result_t* scc_find_parallel_csr(const csr_graph_t* csr, const scc_parallel_config_t* config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SCC_PARALLEL_H
@@ -0,0 +1,168 @@
+#include "graph.h"
+#include "scc.h"
+#include <stdlib.h>
+#include <string.h>
+
+// CSR 그래프 생성 (offsets는 0으로 초기화, targets는 미초기화)
+csr_graph_t* csr_graph_create(int num_vertices, int64_t num_edges) {
+    if (num_vertices < 0 || num_edges < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    csr_graph_t* csr = scc_malloc(sizeof(csr_graph_t));
+    if (!csr) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    csr->num_vertices = num_vertices;
+    csr->num_edges = num_edges;
+    csr->mapping = NULL;
+    csr->mapping_size = 0;
+    csr->offsets = scc_calloc((size_t)num_vertices + 1, sizeof(int64_t));
+    // 간선이 없어도 유효한 포인터를 유지
+    csr->targets = scc_malloc((num_edges > 0 ? (size_t)num_edges : 1) * sizeof(int));
+    if (!csr->offsets || !csr->targets) {
+        scc_free(csr->targets);
+        scc_free(csr->offsets);
+        scc_free(csr);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    return csr;
+}
+
+void csr_graph_destroy(csr_graph_t* csr) {
+    if (!csr) return;
+
+    if (csr->mapping) {
+        scc_unmap_file(csr->mapping, csr->mapping_size);
+    } else {
+        scc_free(csr->targets);
+        scc_free(csr->offsets);
+    }
+    scc_free(csr);
+}
+
+// 연결 리스트 그래프를 CSR로 고정
+// 각 정점의 간선 순서는 연결 리스트 순서를 그대로 유지하므로
+// CSR 위의 알고리즘은 원본 그래프와 동일한 순회 순서를 가짐
+csr_graph_t* graph_freeze(const graph_t* graph) {
+    if (!graph) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    int num_vertices = graph->num_vertices;
+    csr_graph_t* csr = csr_graph_create(num_vertices, graph->num_edges);
+    if (!csr) return NULL;
+
+    // 차수 누적합으로 오프셋 계산
+    for (int v = 0; v < num_vertices; v++) {
+        csr->offsets[v + 1] = csr->offsets[v] + graph->vertices[v].out_degree;
+    }
+
+    // 간선 대상 채우기
+    for (int v = 0; v < num_vertices; v++) {
+        int64_t pos = csr->offsets[v];
+        edge_t* edge = graph->vertices[v].edges;
+        while (edge) {
+            csr->targets[pos++] = edge->dest;
+            edge = edge->next;
+        }
+    }
+
+    return csr;
+}
+
+// 계수 정렬 기반 전치: O(V + E)
+// 각 정점의 역방향 이웃은 소스 정점 번호 오름차순으로 정렬됨
+csr_graph_t* csr_graph_transpose(const csr_graph_t* csr) {
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    csr_graph_t* transpose = csr_graph_create(csr->num_vertices, csr->num_edges);
+    if (!transpose) return NULL;
+
+    csr_graph_transpose_fill(csr, transpose);
+    return transpose;
+}
+
+// 미리 할당된 버퍼에 전치 그래프를 채움 (할당 없음)
+// 진입 차수를 offsets[d + 2]에 세고 누적하면 offsets[d + 1]이 d의 시작 위치가 되고,
+// 채우는 동안 이를 커서로 밀어 올리면 d의 끝(= d + 1의 시작)이 되므로
+// 별도의 커서 배열이 필요 없음
+// transpose의 offsets는 num_vertices + 1개, targets는 num_edges개 이상이어야 함
+void csr_graph_transpose_fill(const csr_graph_t* csr, csr_graph_t* transpose) {
+    int num_vertices = csr->num_vertices;
+
+    transpose->num_vertices = num_vertices;
+    transpose->num_edges = csr->num_edges;
+    memset(transpose->offsets, 0, ((size_t)num_vertices + 1) * sizeof(int64_t));
+
+    for (int64_t e = 0; e < csr->num_edges; e++) {
+        int dest = csr->targets[e];
+        if (dest + 1 < num_vertices) transpose->offsets[dest + 2]++;
+    }
+    for (int v = 2; v <= num_vertices; v++) {
+        transpose->offsets[v] += transpose->offsets[v - 1];
+    }
+
+    for (int src = 0; src < num_vertices; src++) {
+        for (int64_t e = csr->offsets[src]; e < csr->offsets[src + 1]; e++) {
+            transpose->targets[transpose->offsets[csr->targets[e] + 1]++] = src;
+        }
+    }
+}
+
+// 연결 리스트 그래프에서 바로 역방향 인접 배열 생성: O(V + E)
+// 중간 CSR이나 간선 중복 검사 없이 계수 정렬 두 번의 순회로 끝남
+csr_graph_t* graph_transpose_csr(const graph_t* graph) {
+    if (!graph) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    csr_graph_t* transpose = csr_graph_create(graph->num_vertices, graph->num_edges);
+    if (!transpose) return NULL;
+
+    graph_transpose_csr_fill(graph, transpose);
+    return transpose;
+}
+
+// 미리 할당된 버퍼에 역방향 인접 배열을 채움 (할당 없음, 방식은 위와 동일)
+void graph_transpose_csr_fill(const graph_t* graph, csr_graph_t* transpose) {
+    int num_vertices = graph->num_vertices;
+
+    transpose->num_vertices = num_vertices;
+    transpose->num_edges = graph->num_edges;
+    memset(transpose->offsets, 0, ((size_t)num_vertices + 1) * sizeof(int64_t));
+
+    for (int src = 0; src < num_vertices; src++) {
+        for (edge_t* edge = graph->vertices[src].edges; edge; edge = edge->next) {
+            if (edge->dest + 1 < num_vertices) transpose->offsets[edge->dest + 2]++;
+        }
+    }
+    for (int v = 2; v <= num_vertices; v++) {
+        transpose->offsets[v] += transpose->offsets[v - 1];
+    }
+
+    for (int src = 0; src < num_vertices; src++) {
+        for (edge_t* edge = graph->vertices[src].edges; edge; edge = edge->next) {
+            transpose->targets[transpose->offsets[edge->dest + 1]++] = src;
+        }
+    }
+}
+
+int csr_graph_get_out_degree(const csr_graph_t* csr, int vertex) {
+    if (!csr || vertex < 0 || vertex >= csr->num_vertices) {
+        scc_set_error(SCC_ERROR_INVALID_VERTEX);
+        return -1;
+    }
+
+    return (int)(csr->offsets[vertex + 1] - csr->offsets[vertex]);
+}
@@ -0,0 +1,811 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "graph.h"
+#include "scc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define CSR_IO_USE_MMAP 0
+#else
+#define CSR_IO_USE_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#define CSR_IO_OMP(directive) _Pragma(#directive)
+#else
+#define CSR_IO_OMP(directive)   // OpenMP 없이 빌드하면 순차 실행
+#endif
+
+// 원자적 증가 (OpenMP 2.0에는 atomic capture가 없으므로 컴파일러 내장 함수 사용)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CSR_IO_FETCH_ADD_INT64(ptr, value) _InterlockedExchangeAdd64((volatile __int64*)(ptr), (value))
+#else
+#define CSR_IO_FETCH_ADD_INT64(ptr, value) __sync_fetch_and_add((ptr), (value))
+#endif
+
+#define CSR_IO_CHUNKS_PER_THREAD 4
+#define CSR_IO_MIN_CHUNK_BYTES (1 << 20)   // 이보다 작은 조각으로는 나누지 않음
+#define CSR_IO_INSERTION_SORT 32
+#define CSR_IO_STREAM_BLOCK (1 << 20)      // 스트림 로더의 읽기 단위
+
+// 파싱 오류 (조각별로 기록 후 합침)
+#define PARSE_OK            0
+#define PARSE_INVALID_VERTEX 1
+#define PARSE_NO_MEMORY     2
+
+// 조각 하나의 파싱 결과
+typedef struct edge_chunk {
+    const char* begin;
+    const char* end;
+    int* src;
+    int* dst;
+    uint64_t* external_src;     // 외부 ID 모드: 재매핑 전의 64비트 ID
+    uint64_t* external_dst;
+    bool external;
+    int64_t count;
+    int64_t capacity;
+    int max_vertex;
+    int error;
+} edge_chunk_t;
+
+// 파일 전체를 읽기 전용으로 매핑 (mmap이 없으면 읽어 들임)
+int scc_map_file(const char* filename, const void** data, size_t* size) {
+#if CSR_IO_USE_MMAP
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    *size = (size_t)st.st_size;
+    *data = NULL;
+    if (*size > 0) {
+        void* mapped = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        posix_madvise(mapped, *size, POSIX_MADV_SEQUENTIAL);
+        *data = mapped;
+    }
+
+    close(fd);
+    return SCC_SUCCESS;
+#else
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* buffer = scc_malloc(length > 0 ? (size_t)length : 1);
+    if (!buffer) {
+        fclose(file);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    *size = fread(buffer, 1, length > 0 ? (size_t)length : 0, file);
+    *data = buffer;
+    fclose(file);
+    return SCC_SUCCESS;
+#endif
+}
+
+void scc_unmap_file(const void* data, size_t size) {
+#if CSR_IO_USE_MMAP
+    if (data) munmap((void*)data, size);
+#else
+    (void)size;
+    scc_free((void*)data);
+#endif
+}
+
+static bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// 음이 아닌 10진 정수 파싱: 숫자가 없으면 false
+// 부호가 있거나 limit를 넘으면 정점 번호가 될 수 없으므로 *invalid 설정
+static bool parse_id(const char** cursor, const char* end, uint64_t limit,
+                     uint64_t* value, bool* invalid) {
+    const char* p = *cursor;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    const char* digits = p;
+    uint64_t v = 0;
+    bool overflow = false;
+    while (p < end && (unsigned)(*p - '0') < 10) {
+        unsigned digit = (unsigned)(*p - '0');
+        if (v > limit / 10 || (v == limit / 10 && digit > limit % 10)) {
+            overflow = true;
+        } else {
+            v = v * 10 + digit;
+        }
+        p++;
+    }
+    if (p == digits) return false;
+
+    if (negative || overflow) *invalid = true;
+    *value = v;
+    *cursor = p;
+    return true;
+}
+
+// 두 배열을 함께 확장 (하나라도 실패하면 false, 성공한 쪽은 그대로 유지)
+static bool grow_pair(void** first, void** second, size_t element_size, int64_t capacity) {
+    void* new_first = scc_realloc(*first, (size_t)capacity * element_size);
+    if (new_first) *first = new_first;
+    void* new_second = new_first ? scc_realloc(*second, (size_t)capacity * element_size) : NULL;
+    if (new_second) *second = new_second;
+    return new_first && new_second;
+}
+
+static bool chunk_push(edge_chunk_t* chunk, uint64_t src, uint64_t dest) {
+    if (chunk->count == chunk->capacity) {
+        int64_t capacity = chunk->capacity * 2;
+        bool grown = chunk->external
+            ? grow_pair((void**)&chunk->external_src, (void**)&chunk->external_dst,
+                        sizeof(uint64_t), capacity)
+            : grow_pair((void**)&chunk->src, (void**)&chunk->dst, sizeof(int), capacity);
+        if (!grown) return false;
+        chunk->capacity = capacity;
+    }
+
+    if (chunk->external) {
+        chunk->external_src[chunk->count] = src;
+        chunk->external_dst[chunk->count] = dest;
+    } else {
+        chunk->src[chunk->count] = (int)src;
+        chunk->dst[chunk->count] = (int)dest;
+        if ((int)src > chunk->max_vertex) chunk->max_vertex = (int)src;
+        if ((int)dest > chunk->max_vertex) chunk->max_vertex = (int)dest;
+    }
+    chunk->count++;
+    return true;
+}
+
+// 조각 안의 줄들을 파싱: "src dest"로 시작하지 않는 줄(빈 줄, '#' 주석,
+// 정수가 하나뿐인 줄)은 건너뛰고, 두 정수 뒤의 내용은 무시
+static void parse_chunk(edge_chunk_t* chunk) {
+    // 한 줄이 최소 4바이트("0 1\n")이므로 대략 그 절반 정도로 시작
+    chunk->capacity = (chunk->end - chunk->begin) / 8 + 16;
+    bool allocated;
+    if (chunk->external) {
+        chunk->external_src = scc_malloc((size_t)chunk->capacity * sizeof(uint64_t));
+        chunk->external_dst = scc_malloc((size_t)chunk->capacity * sizeof(uint64_t));
+        allocated = chunk->external_src && chunk->external_dst;
+    } else {
+        chunk->src = scc_malloc((size_t)chunk->capacity * sizeof(int));
+        chunk->dst = scc_malloc((size_t)chunk->capacity * sizeof(int));
+        allocated = chunk->src && chunk->dst;
+    }
+    if (!allocated) {
+        chunk->error = PARSE_NO_MEMORY;
+        return;
+    }
+
+    uint64_t limit = chunk->external ? UINT64_MAX : INT_MAX;
+    const char* p = chunk->begin;
+    const char* end = chunk->end;
+    while (p < end) {
+        while (p < end && is_blank(*p)) p++;
+
+        uint64_t src, dest;
+        bool invalid = false;
+        if (p < end && *p != '#' && parse_id(&p, end, limit, &src, &invalid)) {
+            const char* after_src = p;
+            while (p < end && is_blank(*p)) p++;
+            if (p > after_src && parse_id(&p, end, limit, &dest, &invalid)) {
+                if (invalid) {
+                    chunk->error = PARSE_INVALID_VERTEX;
+                    return;
+                }
+                if (!chunk_push(chunk, src, dest)) {
+                    chunk->error = PARSE_NO_MEMORY;
+                    return;
+                }
+            }
+        }
+
+        // 줄의 나머지를 건너뜀
+        const char* newline = memchr(p, '\n', (size_t)(end - p));
+        p = newline ? newline + 1 : end;
+    }
+}
+
+static void insertion_sort(int* values, int64_t count) {
+    for (int64_t i = 1; i < count; i++) {
+        int value = values[i];
+        int64_t j = i;
+        while (j > 0 && values[j - 1] > value) {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = value;
+    }
+}
+
+static int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// 정렬 후 중복을 제거하고 남은 개수를 반환
+static int64_t sort_unique(int* values, int64_t count) {
+    if (count < CSR_IO_INSERTION_SORT) {
+        insertion_sort(values, count);
+    } else {
+        qsort(values, (size_t)count, sizeof(int), compare_int);
+    }
+
+    int64_t unique = 0;
+    for (int64_t i = 0; i < count; i++) {
+        if (unique == 0 || values[unique - 1] != values[i]) {
+            values[unique++] = values[i];
+        }
+    }
+    return unique;
+}
+
+// 조각별 간선 버퍼로 CSR 구성
+// 계수 → 누적합 → 채우기 후 정점별로 정렬/중복 제거하고 앞으로 압축
+static csr_graph_t* build_csr(edge_chunk_t* chunks, int num_chunks, int num_vertices,
+                              int num_threads) {
+    int64_t total = 0;
+    for (int c = 0; c < num_chunks; c++) {
+        total += chunks[c].count;
+    }
+
+    csr_graph_t* csr = csr_graph_create(num_vertices, total);
+    if (!csr) return NULL;
+
+    int64_t* cursor = scc_malloc(((size_t)num_vertices + 1) * sizeof(int64_t));
+    if (!cursor) {
+        csr_graph_destroy(csr);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    int64_t* offsets = csr->offsets;
+    int* targets = csr->targets;
+
+    CSR_IO_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+    for (int c = 0; c < num_chunks; c++) {
+        const int* src = chunks[c].src;
+        if (num_threads > 1) {
+            for (int64_t e = 0; e < chunks[c].count; e++) {
+                CSR_IO_OMP(omp atomic)
+                offsets[src[e] + 1]++;
+            }
+        } else {
+            for (int64_t e = 0; e < chunks[c].count; e++) {
+                offsets[src[e] + 1]++;
+            }
+        }
+    }
+
+    for (int v = 0; v < num_vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    memcpy(cursor, offsets, ((size_t)num_vertices + 1) * sizeof(int64_t));
+
+    CSR_IO_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+    for (int c = 0; c < num_chunks; c++) {
+        const int* src = chunks[c].src;
+        const int* dst = chunks[c].dst;
+        // 원자 연산은 캐시 미스마다 비싸므로 스레드가 하나면 생략
+        if (num_threads > 1) {
+            for (int64_t e = 0; e < chunks[c].count; e++) {
+                targets[CSR_IO_FETCH_ADD_INT64(&cursor[src[e]], 1)] = dst[e];
+            }
+        } else {
+            for (int64_t e = 0; e < chunks[c].count; e++) {
+                targets[cursor[src[e]]++] = dst[e];
+            }
+        }
+        
+        // 조각 버퍼는 더 이상 필요 없으므로 최대 메모리를 줄이기 위해 바로 해제
+        scc_free(chunks[c].src);
+        scc_free(chunks[c].dst);
+        chunks[c].src = NULL;
+        chunks[c].dst = NULL;
+    }
+
+    scc_free(cursor);
+
+    if (csr_graph_sort_targets(csr, num_threads) != SCC_SUCCESS) {
+        csr_graph_destroy(csr);
+        return NULL;
+    }
+    return csr;
+}
+
+// 정점별로 정렬/중복 제거한 뒤 앞으로 압축
+int csr_graph_sort_targets(csr_graph_t* csr, int num_threads) {
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    if (csr->mapping || num_threads < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+#ifdef _OPENMP
+    if (num_threads == 0) num_threads = omp_get_max_threads();
+#else
+    num_threads = 1;
+#endif
+
+    int num_vertices = csr->num_vertices;
+    int64_t* offsets = csr->offsets;
+    int* targets = csr->targets;
+    int64_t total = offsets[num_vertices];
+
+    // 남은 개수를 unique[v]에 기록
+    int64_t* unique = scc_malloc(((size_t)num_vertices + 1) * sizeof(int64_t));
+    if (!unique) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    CSR_IO_OMP(omp parallel for schedule(dynamic, 1024) num_threads(num_threads))
+    for (int v = 0; v < num_vertices; v++) {
+        unique[v] = sort_unique(targets + offsets[v], offsets[v + 1] - offsets[v]);
+    }
+
+    // 압축 위치는 원래 위치보다 앞이므로 순서대로 옮기면 겹치지 않음
+    int64_t write = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        int64_t begin = offsets[v];
+        offsets[v] = write;
+        if (write != begin) {
+            memmove(targets + write, targets + begin, (size_t)unique[v] * sizeof(int));
+        }
+        write += unique[v];
+    }
+    offsets[num_vertices] = write;
+    csr->num_edges = write;
+    scc_free(unique);
+
+    if (write < total && write > 0) {
+        int* shrunk = scc_realloc(csr->targets, (size_t)write * sizeof(int));
+        if (shrunk) csr->targets = shrunk;
+    }
+
+    return SCC_SUCCESS;
+}
+
+static void free_chunks(edge_chunk_t* chunks, int num_chunks) {
+    for (int c = 0; c < num_chunks; c++) {
+        scc_free(chunks[c].src);
+        scc_free(chunks[c].dst);
+        scc_free(chunks[c].external_src);
+        scc_free(chunks[c].external_dst);
+    }
+    scc_free(chunks);
+}
+
+// 파싱된 조각들의 오류를 합치고 CSR을 구성한 뒤 조각 버퍼를 해제
+static csr_graph_t* finish_chunks(edge_chunk_t* chunks, int num_chunks, int num_threads) {
+    int max_vertex = -1;
+    int error = PARSE_OK;
+    for (int c = 0; c < num_chunks; c++) {
+        if (chunks[c].max_vertex > max_vertex) max_vertex = chunks[c].max_vertex;
+        if (chunks[c].error > error) error = chunks[c].error;
+    }
+
+    csr_graph_t* csr = NULL;
+    if (error == PARSE_INVALID_VERTEX) {
+        scc_set_error(SCC_ERROR_INVALID_VERTEX);
+    } else if (error == PARSE_NO_MEMORY) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+    } else if (max_vertex < 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+    } else if (max_vertex == INT_MAX) {
+        scc_set_error(SCC_ERROR_INVALID_VERTEX);
+    } else {
+        csr = build_csr(chunks, num_chunks, max_vertex + 1, num_threads);
+    }
+
+    free_chunks(chunks, num_chunks);
+    return csr;
+}
+
+// 외부 ID를 첫 등장 순서대로 내부 ID로 바꿈
+// 번호가 파일 순서로 결정되도록 조각 순서대로 순차 처리하고, 다 쓴 64비트 버퍼는 바로 해제
+static int remap_chunks(edge_chunk_t* chunks, int num_chunks, scc_id_map_t* map) {
+    for (int c = 0; c < num_chunks; c++) {
+        edge_chunk_t* chunk = &chunks[c];
+        if (chunk->count == 0) continue;
+
+        chunk->src = scc_malloc((size_t)chunk->count * sizeof(int));
+        chunk->dst = scc_malloc((size_t)chunk->count * sizeof(int));
+        if (!chunk->src || !chunk->dst) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+
+        for (int64_t e = 0; e < chunk->count; e++) {
+            int src = scc_id_map_get_or_add(map, chunk->external_src[e]);
+            int dest = src >= 0 ? scc_id_map_get_or_add(map, chunk->external_dst[e]) : src;
+            if (dest < 0) return dest;
+            chunk->src[e] = src;
+            chunk->dst[e] = dest;
+        }
+
+        scc_free(chunk->external_src);
+        scc_free(chunk->external_dst);
+        chunk->external_src = NULL;
+        chunk->external_dst = NULL;
+        chunk->max_vertex = scc_id_map_count(map) - 1;
+    }
+    return SCC_SUCCESS;
+}
+
+// 간선 리스트 파일을 메모리 매핑 후 병렬 파싱하여 CSR로 로드
+// id_map이 있으면 64비트 외부 ID로 파싱한 뒤 조밀한 번호로 재매핑
+static csr_graph_t* load_mapped_edge_list(const char* filename, int num_threads,
+                                          scc_id_map_t* id_map) {
+    if (!filename) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    if (num_threads < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    const void* mapped;
+    size_t size;
+    if (scc_map_file(filename, &mapped, &size) != SCC_SUCCESS) {
+        return NULL;
+    }
+    const char* data = mapped;
+
+#ifdef _OPENMP
+    if (num_threads == 0) num_threads = omp_get_max_threads();
+#else
+    num_threads = 1;
+#endif
+
+    // 줄 경계에 맞춘 조각으로 분할 (각 줄은 시작 위치가 속한 조각이 처리)
+    size_t max_chunks = (size_t)num_threads * CSR_IO_CHUNKS_PER_THREAD;
+    size_t by_size = size / CSR_IO_MIN_CHUNK_BYTES + 1;
+    int num_chunks = (int)(by_size < max_chunks ? by_size : max_chunks);
+
+    edge_chunk_t* chunks = scc_calloc((size_t)num_chunks, sizeof(edge_chunk_t));
+    if (!chunks) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    const char* file_end = data + size;
+    for (int c = 0; c < num_chunks; c++) {
+        const char* begin = data + size / num_chunks * c;
+        if (c > 0 && begin > data && begin[-1] != '\n') {
+            const char* newline = memchr(begin, '\n', (size_t)(file_end - begin));
+            begin = newline ? newline + 1 : file_end;
+        }
+        chunks[c].begin = begin;
+        chunks[c].max_vertex = -1;
+        chunks[c].external = (id_map != NULL);
+        if (c > 0) chunks[c - 1].end = begin;
+    }
+    chunks[num_chunks - 1].end = file_end;
+
+    CSR_IO_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+    for (int c = 0; c < num_chunks; c++) {
+        if (chunks[c].begin < chunks[c].end) {
+            parse_chunk(&chunks[c]);
+        }
+    }
+
+    scc_unmap_file(data, size);
+
+    // 파싱 오류가 있으면 재매핑 없이 finish_chunks가 보고
+    bool parsed = true;
+    for (int c = 0; c < num_chunks; c++) {
+        if (chunks[c].error != PARSE_OK) parsed = false;
+    }
+    if (id_map && parsed && remap_chunks(chunks, num_chunks, id_map) != SCC_SUCCESS) {
+        free_chunks(chunks, num_chunks);
+        return NULL;
+    }
+
+    return finish_chunks(chunks, num_chunks, num_threads);
+}
+
+csr_graph_t* csr_graph_load_edge_list(const char* filename, int num_threads) {
+    return load_mapped_edge_list(filename, num_threads, NULL);
+}
+
+csr_graph_t* csr_graph_load_edge_list_remap(const char* filename, int num_threads,
+                                            scc_id_map_t** id_map) {
+    if (!id_map) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    *id_map = scc_id_map_create(0);
+    if (!*id_map) return NULL;
+
+    csr_graph_t* csr = load_mapped_edge_list(filename, num_threads, *id_map);
+    if (!csr) {
+        scc_id_map_destroy(*id_map);
+        *id_map = NULL;
+    }
+    return csr;
+}
+
+// 버퍼의 [0, length) 범위를 새 조각으로 파싱 (조각 배열은 필요하면 두 배로 확장)
+static bool stream_parse_block(edge_chunk_t** chunks, int* num_chunks, int* chunk_capacity,
+                               const char* data, size_t length) {
+    if (*num_chunks == *chunk_capacity) {
+        int capacity = *chunk_capacity ? *chunk_capacity * 2 : 16;
+        edge_chunk_t* grown = scc_realloc(*chunks, (size_t)capacity * sizeof(edge_chunk_t));
+        if (!grown) return false;
+        *chunks = grown;
+        *chunk_capacity = capacity;
+    }
+
+    edge_chunk_t* chunk = &(*chunks)[(*num_chunks)++];
+    memset(chunk, 0, sizeof(edge_chunk_t));
+    chunk->begin = data;
+    chunk->end = data + length;
+    chunk->max_vertex = -1;
+    parse_chunk(chunk);
+
+    // 버퍼는 다음 블록에 재사용되므로 범위는 남겨 두지 않음
+    chunk->begin = NULL;
+    chunk->end = NULL;
+    return chunk->error == PARSE_OK;
+}
+
+// 스트림에서 간선 리스트를 한 번만 읽어 CSR로 로드
+// 블록 단위로 읽어 완성된 줄만 파싱하고, 잘린 마지막 줄은 다음 블록 앞으로 옮김
+// 블록마다 별도의 조각 버퍼에 쌓으므로 기존 간선을 다시 복사하지 않음
+csr_graph_t* csr_graph_read_edge_list(FILE* stream) {
+    if (!stream) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    size_t capacity = CSR_IO_STREAM_BLOCK;
+    char* buffer = scc_malloc(capacity);
+    if (!buffer) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    edge_chunk_t* chunks = NULL;
+    int num_chunks = 0;
+    int chunk_capacity = 0;
+    size_t length = 0;
+    bool ok = true;
+    bool at_end = false;
+
+    while (ok && !at_end) {
+        length += fread(buffer + length, 1, capacity - length, stream);
+        at_end = length < capacity;
+
+        size_t complete = length;
+        if (!at_end) {
+            while (complete > 0 && buffer[complete - 1] != '\n') complete--;
+
+            // 버퍼보다 긴 줄은 버퍼를 늘려서 마저 읽음
+            if (complete == 0) {
+                char* grown = scc_realloc(buffer, capacity * 2);
+                if (!grown) {
+                    ok = false;
+                    break;
+                }
+                buffer = grown;
+                capacity *= 2;
+                continue;
+            }
+        }
+
+        if (complete > 0) {
+            ok = stream_parse_block(&chunks, &num_chunks, &chunk_capacity, buffer, complete);
+        }
+        memmove(buffer, buffer + complete, length - complete);
+        length -= complete;
+    }
+    scc_free(buffer);
+
+    // 파싱 오류는 finish_chunks가 보고하고, 그 밖의 실패는 여기서 처리
+    bool parse_failed = num_chunks > 0 && chunks[num_chunks - 1].error != PARSE_OK;
+    if (ferror(stream) || (!ok && !parse_failed)) {
+        free_chunks(chunks, num_chunks);
+        scc_set_error(ferror(stream) ? SCC_ERROR_INVALID_PARAMETER : SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    return finish_chunks(chunks, num_chunks, 1);
+}
+
+// 바이너리 CSR 형식
+// [헤더 | 패딩 | offsets (int64 × (V + 1)) | 패딩 | targets (int32 × E)]
+// 각 구획은 CSR_BINARY_ALIGNMENT 경계에서 시작하므로 매핑한 그대로 사용 가능
+#define CSR_BINARY_MAGIC "SCCGRAPH"
+#define CSR_BINARY_VERSION 1
+#define CSR_BINARY_BYTE_ORDER 0x01020304u
+#define CSR_BINARY_ALIGNMENT 4096
+
+typedef struct csr_binary_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;        // 쓴 시스템의 바이트 순서 확인용
+    uint32_t header_size;
+    uint32_t alignment;
+    int64_t num_vertices;
+    int64_t num_edges;
+    uint64_t offsets_pos;
+    uint64_t targets_pos;
+    uint64_t file_size;
+} csr_binary_header_t;
+
+static uint64_t align_up(uint64_t value) {
+    return (value + CSR_BINARY_ALIGNMENT - 1) / CSR_BINARY_ALIGNMENT * CSR_BINARY_ALIGNMENT;
+}
+
+static bool write_padding(FILE* file, uint64_t from, uint64_t to) {
+    static const char zeros[CSR_BINARY_ALIGNMENT];
+    return to - from == 0 || fwrite(zeros, 1, (size_t)(to - from), file) == to - from;
+}
+
+int csr_graph_save_binary(const csr_graph_t* csr, const char* filename) {
+    if (!csr || !filename) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+
+    csr_binary_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CSR_BINARY_MAGIC, sizeof(header.magic));
+    header.version = CSR_BINARY_VERSION;
+    header.byte_order = CSR_BINARY_BYTE_ORDER;
+    header.header_size = sizeof(csr_binary_header_t);
+    header.alignment = CSR_BINARY_ALIGNMENT;
+    header.num_vertices = csr->num_vertices;
+    header.num_edges = csr->num_edges;
+
+    uint64_t offsets_bytes = ((uint64_t)csr->num_vertices + 1) * sizeof(int64_t);
+    uint64_t targets_bytes = (uint64_t)csr->num_edges * sizeof(int);
+    header.offsets_pos = align_up(sizeof(csr_binary_header_t));
+    header.targets_pos = align_up(header.offsets_pos + offsets_bytes);
+    header.file_size = header.targets_pos + targets_bytes;
+
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              write_padding(file, sizeof(header), header.offsets_pos) &&
+              fwrite(csr->offsets, 1, (size_t)offsets_bytes, file) == offsets_bytes &&
+              write_padding(file, header.offsets_pos + offsets_bytes, header.targets_pos) &&
+              fwrite(csr->targets, 1, (size_t)targets_bytes, file) == targets_bytes;
+    if (fclose(file) != 0) ok = false;
+
+    if (!ok) {
+        remove(filename);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+    return SCC_SUCCESS;
+}
+
+// [pos, pos + bytes) 구획이 크기 size인 파일 안에 있는지 확인 (오버플로 없이)
+static bool binary_section_fits(uint64_t pos, uint64_t bytes, uint64_t size) {
+    return pos <= size && bytes <= size - pos;
+}
+
+// 헤더 검증: 구획이 파일 안에 있고 정렬되어 있으며 크기가 맞는지 확인
+// 비용을 O(1)로 유지하기 위해 offsets 단조성과 targets 범위는 검사하지 않음
+static bool binary_header_valid(const csr_binary_header_t* header, size_t size) {
+    if (size < sizeof(csr_binary_header_t) ||
+        memcmp(header->magic, CSR_BINARY_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != CSR_BINARY_VERSION ||
+        header->byte_order != CSR_BINARY_BYTE_ORDER ||
+        header->header_size != sizeof(csr_binary_header_t) ||
+        header->num_vertices < 0 || header->num_vertices > INT_MAX ||
+        header->num_edges < 0 || header->file_size != size) {
+        return false;
+    }
+
+    if (header->offsets_pos % CSR_BINARY_ALIGNMENT != 0 ||
+        header->targets_pos % CSR_BINARY_ALIGNMENT != 0 ||
+        header->offsets_pos < sizeof(csr_binary_header_t)) {
+        return false;
+    }
+
+    // 위치가 손상되어도 덧셈/곱셈이 넘치지 않도록 남은 크기와 비교
+    uint64_t offsets_bytes = ((uint64_t)header->num_vertices + 1) * sizeof(int64_t);
+    if (!binary_section_fits(header->offsets_pos, offsets_bytes, size) ||
+        !binary_section_fits(header->targets_pos, 0, size) ||
+        header->targets_pos < header->offsets_pos + offsets_bytes ||
+        (uint64_t)header->num_edges > (size - header->targets_pos) / sizeof(int)) {
+        return false;
+    }
+    return header->targets_pos + (uint64_t)header->num_edges * sizeof(int) == size;
+}
+
+// 바이너리 CSR 파일을 매핑하여 복사 없이 CSR로 사용
+// offsets/targets는 읽기 전용 매핑을 가리키며 csr_graph_destroy에서 해제됨
+csr_graph_t* csr_graph_map_binary(const char* filename) {
+    if (!filename) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    const void* data;
+    size_t size;
+    if (scc_map_file(filename, &data, &size) != SCC_SUCCESS) {
+        return NULL;
+    }
+
+    const csr_binary_header_t* header = data;
+    if (!data || !binary_header_valid(header, size)) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    const char* base = data;
+    const int64_t* offsets = (const int64_t*)(base + header->offsets_pos);
+    if (offsets[0] != 0 || offsets[header->num_vertices] != header->num_edges) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    csr_graph_t* csr = scc_malloc(sizeof(csr_graph_t));
+    if (!csr) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    csr->num_vertices = (int)header->num_vertices;
+    csr->num_edges = header->num_edges;
+    csr->offsets = (int64_t*)offsets;
+    csr->targets = (int*)(base + header->targets_pos);
+    csr->mapping = data;
+    csr->mapping_size = size;
+
+    return csr;
+}
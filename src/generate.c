@@ -0,0 +1,517 @@
+#include "graph.h"
+#include "scc.h"
+#include "scc_algorithms.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#define GENERATE_OMP(directive) _Pragma(#directive)
+#else
+#define GENERATE_OMP(directive)   // OpenMP 없이 빌드하면 순차 실행
+#endif
+
+// 원자적 증가 (OpenMP 2.0에는 atomic capture가 없으므로 컴파일러 내장 함수 사용)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define GENERATE_FETCH_ADD_INT64(ptr, value) _InterlockedExchangeAdd64((volatile __int64*)(ptr), (value))
+#else
+#define GENERATE_FETCH_ADD_INT64(ptr, value) __sync_fetch_and_add((ptr), (value))
+#endif
+
+#define GENERATE_BLOCKS_PER_THREAD 8
+#define GENERATE_MIN_BLOCK_EDGES (1 << 16)   // 이보다 작은 블록으로는 나누지 않음
+#define GENERATE_BATCH 256                   // 생성 후 한꺼번에 반영하는 간선 수
+
+// 난수 스트림: 같은 시드에서도 용도별로 독립적인 값을 얻기 위해 키를 분리
+#define STREAM_EDGE        1
+#define STREAM_ORIENTATION 2
+#define STREAM_SIZE        3
+#define STREAM_PERMUTATION 4
+
+#define GOLDEN_GAMMA 0x9e3779b97f4a7c15ULL
+
+// SplitMix64 최종 혼합 함수
+static uint64_t mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t stream_key(uint64_t seed, uint64_t stream) {
+    return mix64(seed + stream * GOLDEN_GAMMA);
+}
+
+// 카운터 기반 난수: (키, 카운터)만으로 값이 정해지므로 스레드 분할과 무관
+static uint64_t random_at(uint64_t key, uint64_t counter) {
+    return mix64(key + (counter + 1) * GOLDEN_GAMMA);
+}
+
+// [0, bound) 균등 정수 (bound < 2^32: 곱셈 후 상위 비트 사용)
+static int random_below(uint64_t random, int bound) {
+    return (int)(((random >> 32) * (uint64_t)bound) >> 32);
+}
+
+// 정점 번호 섞기: [0, 2^bits) 위의 전단사 (홀수 곱셈, 상수 XOR, 오른쪽 xorshift는
+// 모두 역이 있음). n이 2의 거듭제곱이 아니면 n 미만이 될 때까지 반복 적용하면
+// [0, n)의 전단사가 됨
+#define PERMUTATION_ROUNDS 3
+
+typedef struct vertex_permutation {
+    uint64_t xor_keys[PERMUTATION_ROUNDS];
+    uint64_t multipliers[PERMUTATION_ROUNDS];
+    uint64_t mask;
+    int shift;
+    int num_vertices;
+} vertex_permutation_t;
+
+static vertex_permutation_t permutation_create(uint64_t seed, int num_vertices) {
+    vertex_permutation_t perm;
+    uint64_t key = stream_key(seed, STREAM_PERMUTATION);
+    int bits = 1;
+    while (bits < 31 && (1LL << bits) < num_vertices) {
+        bits++;
+    }
+
+    perm.mask = (1ULL << bits) - 1;
+    perm.shift = (bits + 1) / 2;
+    perm.num_vertices = num_vertices;
+    for (int round = 0; round < PERMUTATION_ROUNDS; round++) {
+        perm.xor_keys[round] = random_at(key, (uint64_t)round * 2) & perm.mask;
+        perm.multipliers[round] = random_at(key, (uint64_t)round * 2 + 1) | 1;
+    }
+    return perm;
+}
+
+static uint64_t permute_bits(const vertex_permutation_t* perm, uint64_t x) {
+    for (int round = 0; round < PERMUTATION_ROUNDS; round++) {
+        x ^= perm->xor_keys[round];
+        x = (x * perm->multipliers[round]) & perm->mask;
+        x ^= x >> perm->shift;
+    }
+    return x;
+}
+
+static int permutation_apply(const vertex_permutation_t* perm, int vertex) {
+    uint64_t x = (uint64_t)vertex;
+    do {
+        x = permute_bits(perm, x);
+    } while (x >= (uint64_t)perm->num_vertices);
+    return (int)x;
+}
+
+// 생성기 공통 상태: edge_at이 간선 슬롯 번호만으로 간선을 만들어 냄
+typedef struct generator generator_t;
+typedef bool (*edge_at_func_t)(const generator_t* gen, int64_t slot, int* src, int* dst);
+
+struct generator {
+    edge_at_func_t edge_at;     // false면 그 슬롯은 간선을 만들지 않음
+    int num_vertices;
+    int64_t num_slots;
+    uint64_t key;
+    uint64_t orientation_key;
+
+    // R-MAT
+    int scale;
+    uint64_t threshold_a;       // 사분면 누적 확률 * 2^32
+    uint64_t threshold_ab;
+    uint64_t threshold_abc;
+
+    // Barabasi-Albert와 심은 SCC의 정점당 간선 수
+    int edges_per_vertex;
+
+    // 심은 SCC
+    const int* component_starts;    // num_components + 1
+    int num_components;
+
+    vertex_permutation_t perm;
+};
+
+static int64_t block_begin(const generator_t* gen, int num_blocks, int block) {
+    return (block == num_blocks) ? gen->num_slots : gen->num_slots / num_blocks * block;
+}
+
+// [*slot, end)에서 간선을 최대 GENERATE_BATCH개 생성
+// 생성과 메모리 갱신을 분리하면 갱신 루프에서 캐시 미스 여러 개가 동시에 진행됨
+static int generate_batch(const generator_t* gen, int64_t* slot, int64_t end,
+                          int* src, int* dst) {
+    int count = 0;
+    while (*slot < end && count < GENERATE_BATCH) {
+        if (gen->edge_at(gen, *slot, &src[count], &dst[count])) count++;
+        (*slot)++;
+    }
+    return count;
+}
+
+// 간선 슬롯을 두 번 생성: 계수로 오프셋을 만들고, 다시 생성해 채움
+// 간선 목록을 따로 저장하지 않으므로 최대 메모리는 CSR 자체뿐
+static csr_graph_t* generate_csr(const generator_t* gen, int num_threads) {
+    if (num_threads < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+#ifdef _OPENMP
+    if (num_threads == 0) num_threads = omp_get_max_threads();
+#else
+    num_threads = 1;
+#endif
+
+    int num_vertices = gen->num_vertices;
+    csr_graph_t* csr = csr_graph_create(num_vertices, gen->num_slots);
+    if (!csr) return NULL;
+
+    int64_t* cursor = scc_malloc(((size_t)num_vertices + 1) * sizeof(int64_t));
+    if (!cursor) {
+        csr_graph_destroy(csr);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    int64_t max_blocks = (int64_t)num_threads * GENERATE_BLOCKS_PER_THREAD;
+    int64_t by_size = gen->num_slots / GENERATE_MIN_BLOCK_EDGES + 1;
+    int num_blocks = (int)(by_size < max_blocks ? by_size : max_blocks);
+    int64_t* offsets = csr->offsets;
+    int* targets = csr->targets;
+
+    GENERATE_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+    for (int b = 0; b < num_blocks; b++) {
+        int src[GENERATE_BATCH], dst[GENERATE_BATCH];
+        int64_t slot = block_begin(gen, num_blocks, b);
+        int64_t end = block_begin(gen, num_blocks, b + 1);
+        while (slot < end) {
+            int count = generate_batch(gen, &slot, end, src, dst);
+            // 원자 연산은 캐시 미스마다 비싸므로 스레드가 하나면 생략
+            if (num_threads > 1) {
+                for (int i = 0; i < count; i++) {
+                    GENERATE_OMP(omp atomic)
+                    offsets[src[i] + 1]++;
+                }
+            } else {
+                for (int i = 0; i < count; i++) {
+                    offsets[src[i] + 1]++;
+                }
+            }
+        }
+    }
+
+    for (int v = 0; v < num_vertices; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    memcpy(cursor, offsets, ((size_t)num_vertices + 1) * sizeof(int64_t));
+
+    GENERATE_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+    for (int b = 0; b < num_blocks; b++) {
+        int src[GENERATE_BATCH], dst[GENERATE_BATCH];
+        int64_t slot = block_begin(gen, num_blocks, b);
+        int64_t end = block_begin(gen, num_blocks, b + 1);
+        while (slot < end) {
+            int count = generate_batch(gen, &slot, end, src, dst);
+            if (num_threads > 1) {
+                for (int i = 0; i < count; i++) {
+                    targets[GENERATE_FETCH_ADD_INT64(&cursor[src[i]], 1)] = dst[i];
+                }
+            } else {
+                for (int i = 0; i < count; i++) {
+                    targets[cursor[src[i]]++] = dst[i];
+                }
+            }
+        }
+    }
+    scc_free(cursor);
+
+    // 채우는 순서는 스레드마다 달라지지만 정렬 후에는 같은 그래프
+    if (csr_graph_sort_targets(csr, num_threads) != SCC_SUCCESS) {
+        csr_graph_destroy(csr);
+        return NULL;
+    }
+    return csr;
+}
+
+// CSR을 그래프로 변환 (graph_t 간선 수는 int 범위)
+static graph_t* generated_graph(csr_graph_t* csr) {
+    if (!csr) return NULL;
+
+    graph_t* graph = graph_from_csr(csr);
+    csr_graph_destroy(csr);
+    return graph;
+}
+
+// Erdos-Renyi G(n, m)
+static bool erdos_renyi_edge_at(const generator_t* gen, int64_t slot, int* src, int* dst) {
+    int n = gen->num_vertices;
+    *src = random_below(random_at(gen->key, (uint64_t)slot * 2), n);
+    // 자기 루프가 생기지 않도록 n - 1개 중에서 고른 뒤 src 이상이면 한 칸 밀어 냄
+    int d = random_below(random_at(gen->key, (uint64_t)slot * 2 + 1), n - 1);
+    *dst = (d >= *src) ? d + 1 : d;
+    return true;
+}
+
+csr_graph_t* csr_graph_generate_erdos_renyi(int num_vertices, int64_t num_edges,
+                                            uint64_t seed, int num_threads) {
+    if (num_vertices < 1 || num_edges < 0 || (num_vertices == 1 && num_edges > 0)) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    generator_t gen;
+    memset(&gen, 0, sizeof(gen));
+    gen.edge_at = erdos_renyi_edge_at;
+    gen.num_vertices = num_vertices;
+    gen.num_slots = num_edges;
+    gen.key = stream_key(seed, STREAM_EDGE);
+    return generate_csr(&gen, num_threads);
+}
+
+graph_t* graph_generate_erdos_renyi(int num_vertices, int num_edges, uint64_t seed) {
+    return generated_graph(csr_graph_generate_erdos_renyi(num_vertices, num_edges, seed, 0));
+}
+
+// R-MAT: 단계마다 인접 행렬을 사분면으로 나누어 하나를 고름
+// 난수 하나의 상위/하위 32비트로 두 단계를 처리하고, 사분면은 누적 임계값 비교로
+// 분기 없이 결정 (행 비트는 r >= a+b, 열 비트는 세 비교의 XOR)
+static bool rmat_edge_at(const generator_t* gen, int64_t slot, int* src, int* dst) {
+    uint64_t row = 0, col = 0;
+    uint64_t random = 0;
+    for (int level = 0; level < gen->scale; level++) {
+        // scale <= 30이므로 슬롯당 카운터 16개면 충분
+        if ((level & 1) == 0) {
+            random = random_at(gen->key, ((uint64_t)slot << 4) | (uint64_t)(level >> 1));
+        }
+        uint32_t r = (uint32_t)random;
+        random >>= 32;
+
+        uint64_t ge_a = (r >= gen->threshold_a);
+        uint64_t ge_ab = (r >= gen->threshold_ab);
+        uint64_t ge_abc = (r >= gen->threshold_abc);
+        row = (row << 1) | ge_ab;
+        col = (col << 1) | (ge_a ^ ge_ab ^ ge_abc);
+    }
+
+    // 허브가 작은 번호에 몰리지 않도록 같은 전단사로 양 끝점을 섞음 (정점 수가 2^scale이라 반복 없음)
+    *src = (int)permute_bits(&gen->perm, row);
+    *dst = (int)permute_bits(&gen->perm, col);
+    return true;
+}
+
+// 누적 확률을 32비트 난수와 비교할 정수 임계값으로 변환 (1.0이면 항상 미만)
+static uint64_t rmat_threshold(double probability) {
+    return (uint64_t)(probability * 4294967296.0 + 0.5);
+}
+
+csr_graph_t* csr_graph_generate_rmat(int scale, int64_t num_edges, double a, double b,
+                                     double c, uint64_t seed, int num_threads) {
+    if (scale < 1 || scale > 30 || num_edges < 0 ||
+        a < 0.0 || b < 0.0 || c < 0.0 || a + b + c > 1.0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    generator_t gen;
+    memset(&gen, 0, sizeof(gen));
+    gen.edge_at = rmat_edge_at;
+    gen.num_vertices = 1 << scale;
+    gen.num_slots = num_edges;
+    gen.key = stream_key(seed, STREAM_EDGE);
+    gen.scale = scale;
+    gen.threshold_a = rmat_threshold(a);
+    gen.threshold_ab = rmat_threshold(a + b);
+    gen.threshold_abc = rmat_threshold(a + b + c);
+    gen.perm = permutation_create(seed, gen.num_vertices);
+    return generate_csr(&gen, num_threads);
+}
+
+graph_t* graph_generate_rmat(int scale, int num_edges, double a, double b, double c,
+                             uint64_t seed) {
+    return generated_graph(csr_graph_generate_rmat(scale, num_edges, a, b, c, seed, 0));
+}
+
+// Barabasi-Albert: 간선 j의 끝점을 위치 1 + 2j(출발점)와 2 + 2j(도착점)에 두는
+// 가상의 끝점 배열에서 앞쪽 위치를 균등하게 고르면 차수에 비례한 선택이 됨
+// (위치 0은 정점 0). 도착점 위치는 그 간선의 선택을 다시 계산해 따라가므로
+// 배열을 만들지 않고도 각 간선을 독립적으로 생성할 수 있음
+static bool barabasi_albert_edge_at(const generator_t* gen, int64_t slot, int* src, int* dst) {
+    int64_t d = gen->edges_per_vertex;
+    int64_t edge = slot;
+    int target;
+    for (;;) {
+        // 간선 edge의 출발 정점은 edge / d + 1, 그보다 앞선 정점의 끝점만 후보
+        uint64_t candidates = 1 + 2 * (uint64_t)(edge / d) * (uint64_t)d;
+        uint64_t pos = random_at(gen->key, (uint64_t)edge) % candidates;
+        if (pos == 0) {
+            target = 0;
+            break;
+        }
+        int64_t earlier = (int64_t)((pos - 1) / 2);
+        if ((pos - 1) % 2 == 0) {
+            target = (int)(earlier / d + 1);
+            break;
+        }
+        edge = earlier;     // 앞선 간선의 도착점: 같은 규칙으로 계속 따라감
+    }
+
+    int source = (int)(slot / d + 1);
+    if (random_at(gen->orientation_key, (uint64_t)slot) & 1) {
+        *src = target;
+        *dst = source;
+    } else {
+        *src = source;
+        *dst = target;
+    }
+    return true;
+}
+
+csr_graph_t* csr_graph_generate_barabasi_albert(int num_vertices, int edges_per_vertex,
+                                                uint64_t seed, int num_threads) {
+    if (num_vertices < 1 || edges_per_vertex < 1) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    generator_t gen;
+    memset(&gen, 0, sizeof(gen));
+    gen.edge_at = barabasi_albert_edge_at;
+    gen.num_vertices = num_vertices;
+    gen.num_slots = (int64_t)(num_vertices - 1) * edges_per_vertex;
+    gen.key = stream_key(seed, STREAM_EDGE);
+    gen.orientation_key = stream_key(seed, STREAM_ORIENTATION);
+    gen.edges_per_vertex = edges_per_vertex;
+    return generate_csr(&gen, num_threads);
+}
+
+graph_t* graph_generate_barabasi_albert(int num_vertices, int edges_per_vertex,
+                                        uint64_t seed) {
+    return generated_graph(csr_graph_generate_barabasi_albert(num_vertices, edges_per_vertex,
+                                                              seed, 0));
+}
+
+// 섞기 전 번호 vertex가 속한 심은 컴포넌트 (시작 위치 이진 탐색)
+static int planted_component_of(const generator_t* gen, int vertex) {
+    int lo = 0, hi = gen->num_components - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (gen->component_starts[mid] <= vertex) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
+// 정점마다 슬롯 edges_per_vertex개: 0번은 컴포넌트 사이클의 다음 정점,
+// 나머지는 반반으로 같은 컴포넌트 내부 또는 뒤쪽 컴포넌트로 향함
+static bool planted_edge_at(const generator_t* gen, int64_t slot, int* src, int* dst) {
+    int vertex = (int)(slot / gen->edges_per_vertex);
+    int index = (int)(slot % gen->edges_per_vertex);
+    int component = planted_component_of(gen, vertex);
+    int start = gen->component_starts[component];
+    int size = gen->component_starts[component + 1] - start;
+
+    int target;
+    if (index == 0) {
+        target = start + (vertex - start + 1) % size;
+    } else {
+        uint64_t r = random_at(gen->key, (uint64_t)slot);
+        int later = gen->num_components - 1 - component;
+        if ((r & 1) == 0 || later == 0) {
+            target = start + random_below(r, size);
+        } else {
+            int other = component + 1 + random_below(random_at(gen->orientation_key, (uint64_t)slot), later);
+            int other_start = gen->component_starts[other];
+            target = other_start + random_below(r, gen->component_starts[other + 1] - other_start);
+        }
+    }
+
+    if (target == vertex) return false;    // 크기 1 컴포넌트의 사이클, 내부 자기 루프
+    *src = permutation_apply(&gen->perm, vertex);
+    *dst = permutation_apply(&gen->perm, target);
+    return true;
+}
+
+// 심은 분할을 결과 구조로 기록 (컴포넌트 번호 = 심은 순서)
+static scc_result_t* planted_ground_truth(const generator_t* gen) {
+    scc_result_t* result = scc_result_create(gen->num_vertices);
+    if (!result) return NULL;
+
+    int num_components = gen->num_components;
+    memcpy(result->component_offsets, gen->component_starts,
+           ((size_t)num_components + 1) * sizeof(int));
+    result->num_components = num_components;
+
+    for (int c = 0; c < num_components; c++) {
+        for (int v = gen->component_starts[c]; v < gen->component_starts[c + 1]; v++) {
+            int vertex = permutation_apply(&gen->perm, v);
+            result->vertices[v] = vertex;
+            result->vertex_to_component[vertex] = c;
+        }
+    }
+
+    scc_result_compute_statistics(result);
+    return result;
+}
+
+csr_graph_t* csr_graph_generate_planted_scc(int num_components, int min_size, int max_size,
+                                            int edges_per_vertex, uint64_t seed,
+                                            int num_threads, scc_result_t** ground_truth) {
+    if (ground_truth) *ground_truth = NULL;
+    if (num_components < 1 || min_size < 1 || max_size < min_size || edges_per_vertex < 1) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    int* starts = scc_malloc(((size_t)num_components + 1) * sizeof(int));
+    if (!starts) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    // 컴포넌트 크기도 시드만으로 정해짐
+    uint64_t size_key = stream_key(seed, STREAM_SIZE);
+    int64_t total = 0;
+    starts[0] = 0;
+    for (int c = 0; c < num_components && total <= INT_MAX; c++) {
+        total += min_size + random_below(random_at(size_key, (uint64_t)c), max_size - min_size + 1);
+        if (total <= INT_MAX) starts[c + 1] = (int)total;
+    }
+    if (total > INT_MAX) {
+        scc_free(starts);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    generator_t gen;
+    memset(&gen, 0, sizeof(gen));
+    gen.edge_at = planted_edge_at;
+    gen.num_vertices = (int)total;
+    gen.num_slots = total * edges_per_vertex;
+    gen.key = stream_key(seed, STREAM_EDGE);
+    gen.orientation_key = stream_key(seed, STREAM_ORIENTATION);
+    gen.edges_per_vertex = edges_per_vertex;
+    gen.component_starts = starts;
+    gen.num_components = num_components;
+    gen.perm = permutation_create(seed, gen.num_vertices);
+
+    csr_graph_t* csr = generate_csr(&gen, num_threads);
+    if (csr && ground_truth) {
+        *ground_truth = planted_ground_truth(&gen);
+        if (!*ground_truth) {
+            csr_graph_destroy(csr);
+            csr = NULL;
+        }
+    }
+
+    scc_free(starts);
+    return csr;
+}
+
+graph_t* graph_generate_planted_scc(int num_components, int min_size, int max_size,
+                                    int edges_per_vertex, uint64_t seed,
+                                    scc_result_t** ground_truth) {
+    graph_t* graph = generated_graph(csr_graph_generate_planted_scc(
+        num_components, min_size, max_size, edges_per_vertex, seed, 0, ground_truth));
+    if (!graph && ground_truth) {
+        scc_result_destroy(*ground_truth);
+        *ground_truth = NULL;
+    }
+    return graph;
+}
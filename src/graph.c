@@ -1,15 +1,44 @@
 #include "graph.h"
 #include "scc.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stdint.h>
+#include <limits.h>
+
+// 고차수 정점의 간선 해시 인덱스 (선형 탐사 오픈 어드레싱)
+// 각 슬롯은 dest와, 그 간선을 가리키는 링크(이전 간선의 next)의 주소를
+// 저장하므로 단일 연결 리스트에서도 O(1) 삭제 가능
+// 머리 간선의 링크는 vertex->edges인데, 정점 배열은 재할당으로 옮겨질 수
+// 있으므로 주소 대신 EDGE_INDEX_HEAD 표식을 저장
+static edge_t* edge_index_head_marker;
+#define EDGE_INDEX_HEAD (&edge_index_head_marker)
+
+typedef struct edge_index_slot {
+    int dest;
+    edge_t** link;              // NULL이면 빈 슬롯
+} edge_index_slot_t;
+
+struct edge_index {
+    edge_index_slot_t* slots;
+    int capacity;               // 2의 거듭제곱
+    int size;
+};
 
 // 내부 헬퍼 함수들
 static int graph_ensure_capacity(graph_t* graph, int required_capacity);
-static edge_t* edge_create(int dest);
-static void edge_destroy(edge_t* edge);
-static vertex_t* vertex_create(int id);
-static void vertex_destroy(vertex_t* vertex);
+static edge_t* edge_create(graph_t* graph, int dest);
+static void edge_destroy(graph_t* graph, edge_t* edge);
+static void vertex_init(vertex_t* vertex, int id);
+static void vertex_destroy(graph_t* graph, vertex_t* vertex);
+static bool vertex_link_edge(vertex_t* vertex, edge_t* edge);
+static bool edge_index_build(vertex_t* vertex);
+static uint64_t* bulk_sort_pairs(const int* src, const int* dst, size_t n, int* dst_bits);
+static void edge_index_destroy(vertex_t* vertex);
+static edge_index_slot_t* edge_index_find(const struct edge_index* index, int dest);
+static bool edge_index_insert(struct edge_index* index, int dest, edge_t** link);
+static void edge_index_remove(struct edge_index* index, int dest);
 
 // 그래프 생성 및 소멸
 graph_t* graph_create(int initial_capacity) {
@@ -20,15 +49,15 @@ graph_t* graph_create(int initial_capacity) {
     
     if (initial_capacity == 0) initial_capacity = 16; // 기본 용량
     
-    graph_t* graph = malloc(sizeof(graph_t));
+    graph_t* graph = scc_malloc(sizeof(graph_t));
     if (!graph) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    graph->vertices = calloc(initial_capacity, sizeof(vertex_t*));
+    graph->vertices = scc_malloc(initial_capacity * sizeof(vertex_t));
     if (!graph->vertices) {
-        free(graph);
+        scc_free(graph);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
@@ -36,20 +65,37 @@ graph_t* graph_create(int initial_capacity) {
     graph->num_vertices = 0;
     graph->num_edges = 0;
     graph->capacity = initial_capacity;
-    graph->vertex_pool = NULL;
-    graph->edge_pool = NULL;
+    
+    // 간선은 그래프 전용 슬랩에서 할당
+    graph->edge_pool = memory_pool_create(sizeof(edge_t), sizeof(void*));
+    graph->owns_edge_pool = true;
+    if (!graph->edge_pool) {
+        scc_free(graph->vertices);
+        scc_free(graph);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
     
     return graph;
 }
 
-graph_t* graph_create_with_pools(int initial_capacity, 
-                                 memory_pool_t* vertex_pool,
-                                 memory_pool_t* edge_pool) {
+graph_t* graph_create_with_edge_pool(int initial_capacity, memory_pool_t* edge_pool) {
+    if (!edge_pool) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    if (edge_pool->block_size < sizeof(edge_t)) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+    
     graph_t* graph = graph_create(initial_capacity);
     if (!graph) return NULL;
     
-    graph->vertex_pool = vertex_pool;
+    // 외부 풀은 여러 그래프가 공유할 수 있으므로 소유하지 않음
+    memory_pool_destroy(graph->edge_pool);
     graph->edge_pool = edge_pool;
+    graph->owns_edge_pool = false;
     
     return graph;
 }
@@ -57,15 +103,21 @@ graph_t* graph_create_with_pools(int initial_capacity,
 void graph_destroy(graph_t* graph) {
     if (!graph) return;
     
-    // 모든 정점과 간선 정리
-    for (int i = 0; i < graph->num_vertices; i++) {
-        if (graph->vertices[i]) {
-            vertex_destroy(graph->vertices[i]);
+    if (graph->owns_edge_pool) {
+        // 전용 풀이면 간선을 하나씩 돌지 않고 청크 단위로 해제
+        for (int i = 0; i < graph->num_vertices; i++) {
+            edge_index_destroy(&graph->vertices[i]);
+        }
+        memory_pool_destroy(graph->edge_pool);
+    } else {
+        // 공유 풀에는 간선을 하나씩 반납
+        for (int i = 0; i < graph->num_vertices; i++) {
+            vertex_destroy(graph, &graph->vertices[i]);
         }
     }
     
-    free(graph->vertices);
-    free(graph);
+    scc_free(graph->vertices);
+    scc_free(graph);
 }
 
 // 그래프 수정 함수들
@@ -83,15 +135,40 @@ int graph_add_vertex(graph_t* graph) {
     }
     
     int vertex_id = graph->num_vertices;
-    vertex_t* vertex = vertex_create(vertex_id);
-    if (!vertex) {
+    vertex_init(&graph->vertices[vertex_id], vertex_id);
+    graph->num_vertices++;
+    
+    return vertex_id;
+}
+
+int graph_add_vertices(graph_t* graph, int count) {
+    if (!graph) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
         return -1;
     }
     
-    graph->vertices[vertex_id] = vertex;
-    graph->num_vertices++;
+    if (count < 0 || count > INT_MAX - graph->num_vertices) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return -1;
+    }
     
-    return vertex_id;
+    // 한 번에 필요한 만큼 확보 (반복 호출에서도 상각 O(1)이 되도록 최소 두 배)
+    int required = graph->num_vertices + count;
+    if (required > graph->capacity) {
+        int new_capacity = graph->capacity <= INT_MAX / 2 ? graph->capacity * 2 : INT_MAX;
+        if (new_capacity < required) new_capacity = required;
+        if (graph_ensure_capacity(graph, new_capacity) != SCC_SUCCESS) {
+            return -1;
+        }
+    }
+    
+    int first = graph->num_vertices;
+    for (int i = first; i < required; i++) {
+        vertex_init(&graph->vertices[i], i);
+    }
+    graph->num_vertices = required;
+    
+    return first;
 }
 
 int graph_add_edge(graph_t* graph, int src, int dest) {
@@ -106,27 +183,151 @@ int graph_add_edge(graph_t* graph, int src, int dest) {
         return SCC_ERROR_INVALID_VERTEX;
     }
     
+    vertex_t* src_vertex = &graph->vertices[src];
+    
+    // 차수가 임계값에 도달하면 인덱스를 한 번 만들어 두고 이후로 유지
+    if (!src_vertex->edge_index && src_vertex->out_degree >= GRAPH_EDGE_INDEX_MIN_DEGREE &&
+        !edge_index_build(src_vertex)) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
     // 간선이 이미 존재하는지 확인
     if (graph_has_edge(graph, src, dest)) {
         scc_set_error(SCC_ERROR_EDGE_EXISTS);
         return SCC_ERROR_EDGE_EXISTS;
     }
     
-    vertex_t* src_vertex = graph->vertices[src];
-    edge_t* new_edge = edge_create(dest);
+    edge_t* new_edge = edge_create(graph, dest);
     if (!new_edge) {
         return SCC_ERROR_MEMORY_ALLOCATION;
     }
     
-    // 간선을 리스트 앞에 추가
-    new_edge->next = src_vertex->edges;
-    src_vertex->edges = new_edge;
-    src_vertex->out_degree++;
+    if (!vertex_link_edge(src_vertex, new_edge)) {
+        edge_destroy(graph, new_edge);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
     graph->num_edges++;
     
     return SCC_SUCCESS;
 }
 
+int graph_add_edges_bulk(graph_t* graph, const int* src, const int* dst,
+                         size_t n, unsigned int flags) {
+    if (!graph || (n > 0 && (!src || !dst))) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    
+    // 간선 수는 int로 관리되므로 넘치는 배치는 거부
+    if (n > (size_t)(INT_MAX - graph->num_edges)) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+    
+    // 하나라도 잘못된 정점이 있으면 아무것도 추가하지 않음
+    int num_vertices = graph->num_vertices;
+    for (size_t i = 0; i < n; i++) {
+        if ((unsigned int)src[i] >= (unsigned int)num_vertices ||
+            (unsigned int)dst[i] >= (unsigned int)num_vertices) {
+            scc_set_error(SCC_ERROR_INVALID_VERTEX);
+            return SCC_ERROR_INVALID_VERTEX;
+        }
+    }
+    
+    if (n == 0) return 0;
+    
+    // 간선 저장 공간을 한 번에 확보 (이후 할당은 실패하지 않음)
+    int result = memory_pool_reserve(graph->edge_pool, n);
+    if (result != SCC_SUCCESS) {
+        return result;
+    }
+    
+    // 호출자가 중복이 없음을 보장하면 정렬 없이 바로 연결
+    if (flags & GRAPH_BULK_ASSUME_UNIQUE) {
+        for (size_t i = 0; i < n; i++) {
+            edge_t* edge = edge_create(graph, dst[i]);
+            if (!vertex_link_edge(&graph->vertices[src[i]], edge)) {
+                edge_destroy(graph, edge);
+                return SCC_ERROR_MEMORY_ALLOCATION;
+            }
+            graph->num_edges++;
+        }
+        return (int)n;
+    }
+    
+    // (src, dst) 쌍을 정렬해 같은 소스의 간선을 모으고, 소스 안에서는 도착 정점 순으로 둠
+    // 스크래치는 배치 크기에 비례하므로 큰 그래프에 작은 배치를 자주 넣어도 됨
+    int dst_bits;
+    uint64_t* keys = bulk_sort_pairs(src, dst, n, &dst_bits);
+    if (!keys) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    uint64_t dst_mask = ((uint64_t)1 << dst_bits) - 1;
+    
+    // 배치 안의 중복은 정렬 후 인접하므로 직전 값과 비교
+    // 기존 간선은 인덱스가 있으면 해시로, 없으면 (저차수) 정렬한 목록과 병합하며 확인
+    int added = 0;
+    size_t i = 0;
+    while (i < n && result == SCC_SUCCESS) {
+        int v = (int)(keys[i] >> dst_bits);
+        vertex_t* vertex = &graph->vertices[v];
+        
+        // 중복 검사 없이 채워진 고차수 정점은 먼저 인덱싱
+        if (!vertex->edge_index && vertex->out_degree >= GRAPH_EDGE_INDEX_MIN_DEGREE &&
+            !edge_index_build(vertex)) {
+            result = SCC_ERROR_MEMORY_ALLOCATION;
+            break;
+        }
+        
+        int existing[GRAPH_EDGE_INDEX_MIN_DEGREE];
+        int num_existing = 0;
+        if (!vertex->edge_index) {
+            for (edge_t* edge = vertex->edges; edge; edge = edge->next) {
+                int j = num_existing++;
+                while (j > 0 && existing[j - 1] > edge->dest) {
+                    existing[j] = existing[j - 1];
+                    j--;
+                }
+                existing[j] = edge->dest;
+            }
+        }
+        
+        int next_existing = 0;
+        int previous = -1;
+        for (; i < n && (int)(keys[i] >> dst_bits) == v; i++) {
+            int d = (int)(keys[i] & dst_mask);
+            if (d == previous) continue;
+            previous = d;
+            
+            while (next_existing < num_existing && existing[next_existing] < d) next_existing++;
+            if ((next_existing < num_existing && existing[next_existing] == d) ||
+                (vertex->edge_index && edge_index_find(vertex->edge_index, d))) {
+                continue;
+            }
+            
+            edge_t* edge = edge_create(graph, d);
+            if (!vertex_link_edge(vertex, edge)) {
+                edge_destroy(graph, edge);
+                result = SCC_ERROR_MEMORY_ALLOCATION;
+                break;
+            }
+            added++;
+        }
+        
+        // 다음 배치에서 기존 간선을 다시 훑지 않도록 고차수 정점은 인덱싱
+        if (result == SCC_SUCCESS && !vertex->edge_index &&
+            vertex->out_degree >= GRAPH_EDGE_INDEX_MIN_DEGREE && !edge_index_build(vertex)) {
+            result = SCC_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+    graph->num_edges += added;
+    
+    scc_free(keys);
+    
+    return result == SCC_SUCCESS ? added : result;
+}
+
 int graph_remove_edge(graph_t* graph, int src, int dest) {
     if (!graph) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
@@ -139,7 +340,40 @@ int graph_remove_edge(graph_t* graph, int src, int dest) {
         return SCC_ERROR_INVALID_VERTEX;
     }
     
-    vertex_t* src_vertex = graph->vertices[src];
+    vertex_t* src_vertex = &graph->vertices[src];
+    struct edge_index* index = src_vertex->edge_index;
+    if (index) {
+        edge_index_slot_t* found = edge_index_find(index, dest);
+        if (!found) {
+            return SCC_ERROR_INVALID_PARAMETER; // 간선을 찾을 수 없음
+        }
+        
+        // 링크를 통해 바로 떼어 내고, 다음 간선의 링크를 갱신
+        edge_t** link = found->link;
+        edge_t* edge;
+        if (link == EDGE_INDEX_HEAD) {
+            edge = src_vertex->edges;
+            src_vertex->edges = edge->next;
+        } else {
+            edge = *link;
+            *link = edge->next;
+        }
+        edge_index_remove(index, dest);
+        if (edge->next) {
+            edge_index_find(index, edge->next->dest)->link = link;
+        }
+        
+        edge_destroy(graph, edge);
+        src_vertex->out_degree--;
+        graph->num_edges--;
+        
+        // 차수가 충분히 줄면 인덱스 해제 (임계값 근처의 반복 생성 방지)
+        if (src_vertex->out_degree < GRAPH_EDGE_INDEX_MIN_DEGREE / 2) {
+            edge_index_destroy(src_vertex);
+        }
+        return SCC_SUCCESS;
+    }
+    
     edge_t* edge = src_vertex->edges;
     edge_t* prev = NULL;
     
@@ -152,7 +386,7 @@ int graph_remove_edge(graph_t* graph, int src, int dest) {
                 src_vertex->edges = edge->next;
             }
             
-            edge_destroy(edge);
+            edge_destroy(graph, edge);
             src_vertex->out_degree--;
             graph->num_edges--;
             
@@ -173,7 +407,11 @@ bool graph_has_edge(const graph_t* graph, int src, int dest) {
         return false;
     }
     
-    vertex_t* src_vertex = graph->vertices[src];
+    vertex_t* src_vertex = &graph->vertices[src];
+    if (src_vertex->edge_index) {
+        return edge_index_find(src_vertex->edge_index, dest) != NULL;
+    }
+    
     edge_t* edge = src_vertex->edges;
     
     while (edge) {
@@ -192,7 +430,7 @@ int graph_get_out_degree(const graph_t* graph, int vertex) {
         return -1;
     }
     
-    return graph->vertices[vertex]->out_degree;
+    return graph->vertices[vertex].out_degree;
 }
 
 int graph_get_vertex_count(const graph_t* graph) {
@@ -222,16 +460,14 @@ graph_t* graph_copy(const graph_t* graph) {
     if (!copy) return NULL;
     
     // 모든 정점 추가
-    for (int i = 0; i < graph->num_vertices; i++) {
-        if (graph_add_vertex(copy) != i) {
-            graph_destroy(copy);
-            return NULL;
-        }
+    if (graph_add_vertices(copy, graph->num_vertices) < 0) {
+        graph_destroy(copy);
+        return NULL;
     }
     
     // 모든 간선 복사
     for (int src = 0; src < graph->num_vertices; src++) {
-        vertex_t* vertex = graph->vertices[src];
+        vertex_t* vertex = &graph->vertices[src];
         edge_t* edge = vertex->edges;
         
         while (edge) {
@@ -243,7 +479,7 @@ graph_t* graph_copy(const graph_t* graph) {
         }
         
         // 사용자 데이터 복사
-        copy->vertices[src]->data = vertex->data;
+        copy->vertices[src].data = vertex->data;
     }
     
     return copy;
@@ -259,23 +495,28 @@ graph_t* graph_transpose(const graph_t* graph) {
     if (!transpose) return NULL;
     
     // 모든 정점 추가
-    for (int i = 0; i < graph->num_vertices; i++) {
-        if (graph_add_vertex(transpose) != i) {
-            graph_destroy(transpose);
-            return NULL;
-        }
+    if (graph_add_vertices(transpose, graph->num_vertices) < 0) {
+        graph_destroy(transpose);
+        return NULL;
     }
     
     // 모든 간선을 반대 방향으로 추가
+    // 원본에 중복 간선이 없으므로 전치에도 없음: 중복 검사 없이 바로 연결
     for (int src = 0; src < graph->num_vertices; src++) {
-        vertex_t* vertex = graph->vertices[src];
+        vertex_t* vertex = &graph->vertices[src];
         edge_t* edge = vertex->edges;
         
         while (edge) {
-            if (graph_add_edge(transpose, edge->dest, src) != SCC_SUCCESS) {
+            edge_t* reversed = edge_create(transpose, src);
+            if (!reversed) {
                 graph_destroy(transpose);
                 return NULL;
             }
+            vertex_t* dest_vertex = &transpose->vertices[edge->dest];
+            reversed->next = dest_vertex->edges;
+            dest_vertex->edges = reversed;
+            dest_vertex->out_degree++;
+            transpose->num_edges++;
             edge = edge->next;
         }
     }
@@ -283,6 +524,42 @@ graph_t* graph_transpose(const graph_t* graph) {
     return transpose;
 }
 
+// CSR에서 연결 리스트 그래프 생성
+// CSR에는 중복 간선이 없으므로 중복 검사 없이 저장 공간을 한 번에 확보하고 연결
+graph_t* graph_from_csr(const csr_graph_t* csr) {
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    if (csr->num_edges > INT_MAX) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+    
+    graph_t* graph = graph_create(csr->num_vertices);
+    if (!graph) return NULL;
+    
+    if (graph_add_vertices(graph, csr->num_vertices) < 0 ||
+        memory_pool_reserve(graph->edge_pool, (size_t)csr->num_edges) != SCC_SUCCESS) {
+        graph_destroy(graph);
+        return NULL;
+    }
+    
+    // 앞에 붙이므로 역순으로 연결해야 CSR과 같은 순서가 됨
+    for (int v = 0; v < csr->num_vertices; v++) {
+        vertex_t* vertex = &graph->vertices[v];
+        for (int64_t e = csr->offsets[v + 1] - 1; e >= csr->offsets[v]; e--) {
+            edge_t* edge = edge_create(graph, csr->targets[e]);
+            edge->next = vertex->edges;
+            vertex->edges = edge;
+        }
+        vertex->out_degree = (int)(csr->offsets[v + 1] - csr->offsets[v]);
+    }
+    graph->num_edges = (int)csr->num_edges;
+    
+    return graph;
+}
+
 // 정점 데이터 관리
 int graph_set_vertex_data(graph_t* graph, int vertex, void* data) {
     if (!graph || vertex < 0 || vertex >= graph->num_vertices) {
@@ -290,7 +567,7 @@ int graph_set_vertex_data(graph_t* graph, int vertex, void* data) {
         return SCC_ERROR_INVALID_VERTEX;
     }
     
-    graph->vertices[vertex]->data = data;
+    graph->vertices[vertex].data = data;
     return SCC_SUCCESS;
 }
 
@@ -300,7 +577,7 @@ void* graph_get_vertex_data(const graph_t* graph, int vertex) {
         return NULL;
     }
     
-    return graph->vertices[vertex]->data;
+    return graph->vertices[vertex].data;
 }
 
 // 그래프 검증
@@ -311,7 +588,7 @@ bool graph_is_valid(const graph_t* graph) {
     
     int edge_count = 0;
     for (int i = 0; i < graph->num_vertices; i++) {
-        vertex_t* vertex = graph->vertices[i];
+        vertex_t* vertex = &graph->vertices[i];
         if (!vertex || vertex->id != i) return false;
         
         // 간선 개수 검증
@@ -340,7 +617,7 @@ void graph_print_debug(const graph_t* graph) {
            graph->num_vertices, graph->num_edges, graph->capacity);
     
     for (int i = 0; i < graph->num_vertices; i++) {
-        vertex_t* vertex = graph->vertices[i];
+        vertex_t* vertex = &graph->vertices[i];
         printf("  Vertex %d (degree %d): ", i, vertex->out_degree);
         
         edge_t* edge = vertex->edges;
@@ -358,28 +635,22 @@ static int graph_ensure_capacity(graph_t* graph, int required_capacity) {
         return SCC_SUCCESS;
     }
     
-    vertex_t** new_vertices = realloc(graph->vertices, 
-                                     required_capacity * sizeof(vertex_t*));
+    vertex_t* new_vertices = scc_realloc(graph->vertices, 
+                                     (size_t)required_capacity * sizeof(vertex_t));
     if (!new_vertices) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return SCC_ERROR_MEMORY_ALLOCATION;
     }
     
-    // 새로운 공간을 NULL로 초기화
-    for (int i = graph->capacity; i < required_capacity; i++) {
-        new_vertices[i] = NULL;
-    }
-    
     graph->vertices = new_vertices;
     graph->capacity = required_capacity;
     
     return SCC_SUCCESS;
 }
 
-static edge_t* edge_create(int dest) {
-    edge_t* edge = malloc(sizeof(edge_t));
+static edge_t* edge_create(graph_t* graph, int dest) {
+    edge_t* edge = memory_pool_alloc(graph->edge_pool, sizeof(edge_t));
     if (!edge) {
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
@@ -389,41 +660,234 @@ static edge_t* edge_create(int dest) {
     return edge;
 }
 
-static void edge_destroy(edge_t* edge) {
+static void edge_destroy(graph_t* graph, edge_t* edge) {
     if (edge) {
-        free(edge);
+        memory_pool_free(graph->edge_pool, edge);
     }
 }
 
-static vertex_t* vertex_create(int id) {
-    vertex_t* vertex = malloc(sizeof(vertex_t));
-    if (!vertex) {
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
-        return NULL;
+// 간선을 리스트 앞에 추가: 기존 머리 간선의 링크는 새 간선의 next가 됨
+static bool vertex_link_edge(vertex_t* vertex, edge_t* edge) {
+    struct edge_index* index = vertex->edge_index;
+    if (index && !edge_index_insert(index, edge->dest, EDGE_INDEX_HEAD)) {
+        return false;
     }
     
+    edge->next = vertex->edges;
+    if (index && edge->next) {
+        edge_index_find(index, edge->next->dest)->link = &edge->next;
+    }
+    vertex->edges = edge;
+    vertex->out_degree++;
+    return true;
+}
+
+static void vertex_init(vertex_t* vertex, int id) {
     vertex->id = id;
     vertex->edges = NULL;
     vertex->out_degree = 0;
-    vertex->index = -1;
-    vertex->lowlink = -1;
-    vertex->on_stack = false;
-    vertex->visited = false;
+    vertex->edge_index = NULL;
     vertex->data = NULL;
-    
-    return vertex;
 }
 
-static void vertex_destroy(vertex_t* vertex) {
+static void vertex_destroy(graph_t* graph, vertex_t* vertex) {
     if (!vertex) return;
     
     // 모든 간선 정리
     edge_t* edge = vertex->edges;
     while (edge) {
         edge_t* next = edge->next;
-        edge_destroy(edge);
+        edge_destroy(graph, edge);
         edge = next;
     }
     
-    free(vertex);
-}
\ No newline at end of file
+    edge_index_destroy(vertex);
+}
+
+// 배치 정렬: 각 쌍을 (src << dst_bits) | dst 키로 묶어 LSD 기수 정렬 (11비트씩)
+// 키 폭은 배치의 최대 정점 번호로 정하므로 패스 수는 그래프가 아닌 배치에 맞춰짐
+#define BULK_RADIX_BITS 11
+#define BULK_RADIX_SIZE (1 << BULK_RADIX_BITS)
+
+static int bulk_bit_width(unsigned int value) {
+    int bits = 0;
+    while (value) {
+        bits++;
+        value >>= 1;
+    }
+    return bits;
+}
+
+static uint64_t* bulk_sort_pairs(const int* src, const int* dst, size_t n, int* dst_bits) {
+    unsigned int max_src = 0;
+    unsigned int max_dst = 0;
+    for (size_t i = 0; i < n; i++) {
+        if ((unsigned int)src[i] > max_src) max_src = (unsigned int)src[i];
+        if ((unsigned int)dst[i] > max_dst) max_dst = (unsigned int)dst[i];
+    }
+    *dst_bits = bulk_bit_width(max_dst);
+    int key_bits = bulk_bit_width(max_src) + *dst_bits;
+    
+    uint64_t* keys = scc_malloc(n * sizeof(uint64_t));
+    uint64_t* scratch = scc_malloc(n * sizeof(uint64_t));
+    size_t* counts = scc_malloc(BULK_RADIX_SIZE * sizeof(size_t));
+    if (!keys || !scratch || !counts) {
+        scc_free(keys);
+        scc_free(scratch);
+        scc_free(counts);
+        return NULL;
+    }
+    
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = ((uint64_t)src[i] << *dst_bits) | (uint64_t)dst[i];
+    }
+    
+    for (int shift = 0; shift < key_bits; shift += BULK_RADIX_BITS) {
+        memset(counts, 0, BULK_RADIX_SIZE * sizeof(size_t));
+        for (size_t i = 0; i < n; i++) {
+            counts[(keys[i] >> shift) & (BULK_RADIX_SIZE - 1)]++;
+        }
+        size_t sum = 0;
+        for (int digit = 0; digit < BULK_RADIX_SIZE; digit++) {
+            size_t count = counts[digit];
+            counts[digit] = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < n; i++) {
+            scratch[counts[(keys[i] >> shift) & (BULK_RADIX_SIZE - 1)]++] = keys[i];
+        }
+        
+        uint64_t* sorted = scratch;
+        scratch = keys;
+        keys = sorted;
+    }
+    
+    scc_free(scratch);
+    scc_free(counts);
+    return keys;
+}
+
+// 간선 해시 인덱스 구현
+static uint32_t edge_index_hash(int dest) {
+    uint32_t h = (uint32_t)dest * 2654435769u;
+    return h ^ (h >> 16);
+}
+
+static edge_index_slot_t* edge_index_slots_create(int capacity) {
+    edge_index_slot_t* slots = scc_calloc(capacity, sizeof(edge_index_slot_t));
+    if (!slots) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+    }
+    return slots;
+}
+
+static void edge_index_place(edge_index_slot_t* slots, int capacity, int dest, edge_t** link) {
+    uint32_t mask = (uint32_t)capacity - 1;
+    uint32_t i = edge_index_hash(dest) & mask;
+    while (slots[i].link) {
+        i = (i + 1) & mask;
+    }
+    slots[i].dest = dest;
+    slots[i].link = link;
+}
+
+// 부하율을 1/2 이하로 유지
+static bool edge_index_grow(struct edge_index* index) {
+    int capacity = index->capacity * 2;
+    edge_index_slot_t* slots = edge_index_slots_create(capacity);
+    if (!slots) return false;
+    
+    for (int i = 0; i < index->capacity; i++) {
+        if (index->slots[i].link) {
+            edge_index_place(slots, capacity, index->slots[i].dest, index->slots[i].link);
+        }
+    }
+    
+    scc_free(index->slots);
+    index->slots = slots;
+    index->capacity = capacity;
+    return true;
+}
+
+static bool edge_index_build(vertex_t* vertex) {
+    struct edge_index* index = scc_malloc(sizeof(struct edge_index));
+    if (!index) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return false;
+    }
+    
+    int capacity = 2 * GRAPH_EDGE_INDEX_MIN_DEGREE;
+    while (capacity < 2 * (vertex->out_degree + 1)) capacity <<= 1;
+    
+    index->slots = edge_index_slots_create(capacity);
+    if (!index->slots) {
+        scc_free(index);
+        return false;
+    }
+    index->capacity = capacity;
+    index->size = 0;
+    
+    // 각 간선의 링크는 리스트를 따라가며 얻음
+    edge_t** link = EDGE_INDEX_HEAD;
+    for (edge_t* edge = vertex->edges; edge; edge = edge->next) {
+        edge_index_place(index->slots, capacity, edge->dest, link);
+        index->size++;
+        link = &edge->next;
+    }
+    
+    vertex->edge_index = index;
+    return true;
+}
+
+static void edge_index_destroy(vertex_t* vertex) {
+    if (!vertex->edge_index) return;
+    
+    scc_free(vertex->edge_index->slots);
+    scc_free(vertex->edge_index);
+    vertex->edge_index = NULL;
+}
+
+// dest 간선의 슬롯 (없으면 NULL)
+static edge_index_slot_t* edge_index_find(const struct edge_index* index, int dest) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t i = edge_index_hash(dest) & mask;
+    while (index->slots[i].link) {
+        if (index->slots[i].dest == dest) {
+            return &index->slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+static bool edge_index_insert(struct edge_index* index, int dest, edge_t** link) {
+    if (2 * (index->size + 1) > index->capacity && !edge_index_grow(index)) {
+        return false;
+    }
+    
+    edge_index_place(index->slots, index->capacity, dest, link);
+    index->size++;
+    return true;
+}
+
+// 묘비 없이 뒤따르는 클러스터를 당겨 채우는 삭제
+static void edge_index_remove(struct edge_index* index, int dest) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t i = edge_index_hash(dest) & mask;
+    while (index->slots[i].dest != dest || !index->slots[i].link) {
+        i = (i + 1) & mask;
+    }
+    
+    uint32_t hole = i;
+    for (uint32_t j = (i + 1) & mask; index->slots[j].link; j = (j + 1) & mask) {
+        uint32_t home = edge_index_hash(index->slots[j].dest) & mask;
+        // home이 (hole, j] 구간 밖이면 hole로 옮겨도 탐색 경로가 유지됨
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            index->slots[hole] = index->slots[j];
+            hole = j;
+        }
+    }
+    
+    index->slots[hole].link = NULL;
+    index->size--;
+}
@@ -3,16 +3,70 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
+#include <limits.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#define GRAPH_IO_OMP(directive) _Pragma(#directive)
+#else
+#define GRAPH_IO_OMP(directive)   // OpenMP 없이 빌드하면 순차 실행
+#endif
 
 // 내부 헬퍼 함수들
-static int load_edge_list_format(graph_t** graph, FILE* file);
+static int load_edge_list_format(graph_t** graph, const char* filename);
+static int load_binary_format(graph_t** graph, const char* filename);
+static int save_binary_format(const graph_t* graph, const char* filename);
 static int load_adjacency_list_format(graph_t** graph, FILE* file);
 static int save_edge_list_format(const graph_t* graph, FILE* file);
 static int save_adjacency_list_format(const graph_t* graph, FILE* file);
 static int save_dot_format(const graph_t* graph, FILE* file);
-static char* trim_whitespace(char* str);
-static int parse_integers(const char* line, int* numbers, int max_numbers);
+
+// 로더가 모은 간선을 파일 끝에서 한 번에 CSR로 만들기 위한 버퍼
+typedef struct edge_buffer {
+    int* src;
+    int* dst;
+    size_t count;
+    size_t capacity;
+    bool failed;                // 버퍼 확장 실패
+} edge_buffer_t;
+
+static bool edge_buffer_push(edge_buffer_t* buffer, int src, int dest);
+static csr_graph_t* edge_buffer_to_csr(edge_buffer_t* buffer, int num_vertices);
+static void edge_buffer_free(edge_buffer_t* buffer);
+
+// 텍스트 저장: 정수를 직접 문자열로 바꿔 블록 버퍼에 모은 뒤 큰 단위로 기록
+#define TEXT_BLOCK_ITEMS (1 << 16)          // 블록 하나가 맡는 대략의 간선 수
+#define TEXT_BLOCKS_PER_THREAD 4
+#define TEXT_MAX_LINE_BYTES 40              // 한 줄(또는 인접 리스트의 이웃 하나)의 최대 바이트
+typedef enum {
+    TEXT_SECTION_EDGE_LIST,
+    TEXT_SECTION_ADJACENCY_LIST,
+    TEXT_SECTION_DOT_VERTICES,
+    TEXT_SECTION_DOT_EDGES
+} text_section_t;
+
+typedef struct text_buffer {
+    char* data;
+    size_t length;
+    size_t capacity;
+    bool failed;                // 버퍼 확장 실패
+} text_buffer_t;
+
+static int write_text_section(const graph_t* graph, FILE* file, text_section_t section);
+
+// 인접 리스트 토크나이저 상태 (읽기 블록 경계를 넘어 유지됨)
+#define ADJACENCY_READ_BLOCK (1 << 16)
+typedef struct adjacency_parser {
+    int64_t value;              // 현재 토큰의 값
+    bool in_token;
+    bool negative;
+    bool digits;                // 토큰에 숫자가 하나 이상 있음
+    bool numeric;               // 토큰이 지금까지 정수 형식
+    bool in_comment;            // '#'로 시작한 줄
+    bool line_started;          // 줄에서 공백이 아닌 문자를 봄
+    int src;                    // 줄의 소스 정점, 아직 없으면 -1
+    int max_vertex;
+} adjacency_parser_t;
 
 // 그래프 파일 로드
 int graph_load_from_file(graph_t** graph, const char* filename, graph_format_t format) {
@@ -21,28 +75,56 @@ int graph_load_from_file(graph_t** graph, const char* filename, graph_format_t f
         return SCC_ERROR_NULL_POINTER;
     }
     
+    // "-"는 표준 입력
+    if (strcmp(filename, "-") == 0) {
+        return graph_load_from_stream(graph, stdin, format);
+    }
+    
+    // 간선 리스트는 파일을 직접 매핑하므로 FILE을 열지 않음
+    if (format == GRAPH_FORMAT_EDGE_LIST) {
+        *graph = NULL;
+        return load_edge_list_format(graph, filename);
+    }
+    if (format == GRAPH_FORMAT_BINARY) {
+        *graph = NULL;
+        return load_binary_format(graph, filename);
+    }
+    
     FILE* file = fopen(filename, "r");
     if (!file) {
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
         return SCC_ERROR_INVALID_PARAMETER;
     }
     
-    int result;
+    int result = graph_load_from_stream(graph, file, format);
+    fclose(file);
+    return result;
+}
+
+// 스트림에서 한 번만 읽어 그래프 로드 (되감지 않으므로 파이프에서도 동작)
+int graph_load_from_stream(graph_t** graph, FILE* stream, graph_format_t format) {
+    if (!graph || !stream) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    
+    *graph = NULL;
     switch (format) {
-        case GRAPH_FORMAT_EDGE_LIST:
-            result = load_edge_list_format(graph, file);
-            break;
+        case GRAPH_FORMAT_EDGE_LIST: {
+            csr_graph_t* csr = csr_graph_read_edge_list(stream);
+            if (!csr) {
+                return scc_get_last_error();
+            }
+            *graph = graph_from_csr(csr);
+            csr_graph_destroy(csr);
+            return *graph ? SCC_SUCCESS : scc_get_last_error();
+        }
         case GRAPH_FORMAT_ADJACENCY_LIST:
-            result = load_adjacency_list_format(graph, file);
-            break;
+            return load_adjacency_list_format(graph, stream);
         default:
             scc_set_error(SCC_ERROR_INVALID_PARAMETER);
-            result = SCC_ERROR_INVALID_PARAMETER;
-            break;
+            return SCC_ERROR_INVALID_PARAMETER;
     }
-    
-    fclose(file);
-    return result;
 }
 
 // 그래프 파일 저장
@@ -52,6 +134,10 @@ int graph_save_to_file(const graph_t* graph, const char* filename, graph_format_
         return SCC_ERROR_NULL_POINTER;
     }
     
+    if (format == GRAPH_FORMAT_BINARY) {
+        return save_binary_format(graph, filename);
+    }
+    
     FILE* file = fopen(filename, "w");
     if (!file) {
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
@@ -79,138 +165,178 @@ int graph_save_to_file(const graph_t* graph, const char* filename, graph_format_
     return result;
 }
 
-// 간선 리스트 형식 로드
-static int load_edge_list_format(graph_t** graph, FILE* file) {
-    char line[1024];
-    int max_vertex = -1;
-    
-    // 첫 번째 패스: 최대 정점 번호 찾기
-    long file_pos = ftell(file);
-    while (fgets(line, sizeof(line), file)) {
-        char* trimmed = trim_whitespace(line);
-        if (strlen(trimmed) == 0 || trimmed[0] == '#') {
-            continue; // 빈 줄이나 주석 건너뛰기
-        }
-        
-        int src, dest;
-        if (sscanf(trimmed, "%d %d", &src, &dest) == 2) {
-            if (src > max_vertex) max_vertex = src;
-            if (dest > max_vertex) max_vertex = dest;
-        }
+// 간선 리스트 형식 로드 (메모리 매핑 병렬 파서 → CSR → 연결 리스트)
+static int load_edge_list_format(graph_t** graph, const char* filename) {
+    csr_graph_t* csr = csr_graph_load_edge_list(filename, 0);
+    if (!csr) {
+        return scc_get_last_error();
     }
     
-    if (max_vertex < 0) {
-        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
-        return SCC_ERROR_GRAPH_EMPTY;
+    *graph = graph_from_csr(csr);
+    csr_graph_destroy(csr);
+    return *graph ? SCC_SUCCESS : scc_get_last_error();
+}
+
+// 희소/64비트 ID 간선 리스트 로드 (외부 ID → 조밀한 내부 ID)
+int graph_load_edge_list_remap(graph_t** graph, const char* filename, scc_id_map_t** id_map) {
+    if (!graph || !filename || !id_map) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
     }
     
-    // 그래프 생성
-    *graph = graph_create(max_vertex + 1);
+    *graph = NULL;
+    csr_graph_t* csr = csr_graph_load_edge_list_remap(filename, 0, id_map);
+    if (!csr) {
+        return scc_get_last_error();
+    }
+    
+    *graph = graph_from_csr(csr);
+    csr_graph_destroy(csr);
     if (!*graph) {
-        return SCC_ERROR_MEMORY_ALLOCATION;
+        scc_id_map_destroy(*id_map);
+        *id_map = NULL;
+        return scc_get_last_error();
+    }
+    return SCC_SUCCESS;
+}
+
+// 바이너리 형식 로드 (CSR 매핑 → 연결 리스트)
+// 매핑 자체는 복사가 없지만 graph_t는 간선 풀에 복사해야 함
+// 복사 없이 쓰려면 csr_graph_map_binary와 CSR 알고리즘을 직접 사용
+static int load_binary_format(graph_t** graph, const char* filename) {
+    csr_graph_t* csr = csr_graph_map_binary(filename);
+    if (!csr) {
+        return scc_get_last_error();
     }
     
-    // 모든 정점 추가
-    for (int i = 0; i <= max_vertex; i++) {
-        if (graph_add_vertex(*graph) != i) {
-            graph_destroy(*graph);
-            *graph = NULL;
-            return SCC_ERROR_MEMORY_ALLOCATION;
-        }
+    *graph = graph_from_csr(csr);
+    csr_graph_destroy(csr);
+    return *graph ? SCC_SUCCESS : scc_get_last_error();
+}
+
+// 바이너리 형식 저장 (CSR로 고정한 뒤 그대로 기록)
+static int save_binary_format(const graph_t* graph, const char* filename) {
+    csr_graph_t* csr = graph_freeze(graph);
+    if (!csr) {
+        return scc_get_last_error();
     }
     
-    // 두 번째 패스: 간선 추가
-    fseek(file, file_pos, SEEK_SET);
-    while (fgets(line, sizeof(line), file)) {
-        char* trimmed = trim_whitespace(line);
-        if (strlen(trimmed) == 0 || trimmed[0] == '#') {
-            continue;
-        }
-        
-        int src, dest;
-        if (sscanf(trimmed, "%d %d", &src, &dest) == 2) {
-            int result = graph_add_edge(*graph, src, dest);
-            if (result != SCC_SUCCESS && result != SCC_ERROR_EDGE_EXISTS) {
-                graph_destroy(*graph);
-                *graph = NULL;
-                return result;
-            }
-        }
+    int result = csr_graph_save_binary(csr, filename);
+    csr_graph_destroy(csr);
+    return result;
+}
+
+// 인접 리스트 토큰을 하나 마침: 줄의 첫 정수는 소스, 나머지는 목적지
+// 정수가 아닌 토큰은 건너뜀
+static int adjacency_end_token(adjacency_parser_t* parser, edge_buffer_t* buffer) {
+    if (!parser->in_token) return SCC_SUCCESS;
+    parser->in_token = false;
+    if (!parser->numeric || !parser->digits) return SCC_SUCCESS;
+    
+    // 정점 수(max_vertex + 1)도 int에 들어가야 하므로 INT_MAX는 거부
+    if ((parser->negative && parser->value != 0) || parser->value >= INT_MAX) {
+        scc_set_error(SCC_ERROR_INVALID_VERTEX);
+        return SCC_ERROR_INVALID_VERTEX;
     }
     
+    int vertex = (int)parser->value;
+    if (vertex > parser->max_vertex) parser->max_vertex = vertex;
+    if (parser->src < 0) {
+        parser->src = vertex;
+    } else if (!edge_buffer_push(buffer, parser->src, vertex)) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
     return SCC_SUCCESS;
 }
 
-// 인접 리스트 형식 로드
-static int load_adjacency_list_format(graph_t** graph, FILE* file) {
-    char line[2048];
-    int max_vertex = -1;
-    
-    // 첫 번째 패스: 최대 정점 번호 찾기
-    long file_pos = ftell(file);
-    while (fgets(line, sizeof(line), file)) {
-        char* trimmed = trim_whitespace(line);
-        if (strlen(trimmed) == 0 || trimmed[0] == '#') {
+// 읽은 블록을 한 글자씩 처리 (토큰과 줄은 블록 경계를 넘어 이어질 수 있음)
+static int adjacency_parse_block(adjacency_parser_t* parser, const char* data, size_t length,
+                                 edge_buffer_t* buffer) {
+    int result = SCC_SUCCESS;
+    for (size_t i = 0; i < length && result == SCC_SUCCESS; i++) {
+        char c = data[i];
+        if (c == '\n') {
+            result = adjacency_end_token(parser, buffer);
+            parser->in_comment = false;
+            parser->line_started = false;
+            parser->src = -1;
+        } else if (parser->in_comment) {
             continue;
-        }
-        
-        int numbers[1024]; // 충분히 큰 배열
-        int count = parse_integers(trimmed, numbers, 1024);
-        
-        for (int i = 0; i < count; i++) {
-            if (numbers[i] > max_vertex) {
-                max_vertex = numbers[i];
+        } else if (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f') {
+            result = adjacency_end_token(parser, buffer);
+        } else if (!parser->line_started && c == '#') {
+            parser->in_comment = true;
+        } else {
+            parser->line_started = true;
+            if (!parser->in_token) {
+                parser->in_token = true;
+                parser->numeric = true;
+                parser->digits = false;
+                parser->negative = false;
+                parser->value = 0;
+                if (c == '-' || c == '+') {
+                    parser->negative = (c == '-');
+                    continue;
+                }
+            }
+            
+            if ((unsigned)(c - '0') < 10) {
+                // INT_MAX를 넘으면 더 누적하지 않음 (토큰 끝에서 거부)
+                if (parser->value <= INT_MAX) parser->value = parser->value * 10 + (c - '0');
+                parser->digits = true;
+            } else {
+                parser->numeric = false;
             }
         }
     }
+    return result;
+}
+
+// 인접 리스트 형식 로드 (한 번만 읽음)
+// 줄 길이나 줄당 이웃 수에 제한이 없고, 이웃은 바로 간선 버퍼로 들어감
+// 파일 끝에서 버퍼를 한 번에 CSR로 만든 뒤 간선 리스트 로더처럼 graph_from_csr로 변환
+static int load_adjacency_list_format(graph_t** graph, FILE* file) {
+    char block[ADJACENCY_READ_BLOCK];
+    
+    adjacency_parser_t parser;
+    memset(&parser, 0, sizeof(parser));
+    parser.src = -1;
+    parser.max_vertex = -1;
+    
+    edge_buffer_t buffer = {0};
+    int result = SCC_SUCCESS;
+    size_t length;
+    while (result == SCC_SUCCESS && (length = fread(block, 1, sizeof(block), file)) > 0) {
+        result = adjacency_parse_block(&parser, block, length, &buffer);
+    }
     
-    if (max_vertex < 0) {
+    // 마지막 줄에 개행이 없을 수 있음
+    if (result == SCC_SUCCESS) {
+        result = adjacency_end_token(&parser, &buffer);
+    }
+    if (result == SCC_SUCCESS && parser.max_vertex < 0) {
         scc_set_error(SCC_ERROR_GRAPH_EMPTY);
-        return SCC_ERROR_GRAPH_EMPTY;
+        result = SCC_ERROR_GRAPH_EMPTY;
     }
-    
-    // 그래프 생성
-    *graph = graph_create(max_vertex + 1);
-    if (!*graph) {
-        return SCC_ERROR_MEMORY_ALLOCATION;
+    if (result == SCC_SUCCESS && ferror(file)) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        result = SCC_ERROR_INVALID_PARAMETER;
     }
     
-    // 모든 정점 추가
-    for (int i = 0; i <= max_vertex; i++) {
-        if (graph_add_vertex(*graph) != i) {
-            graph_destroy(*graph);
-            *graph = NULL;
-            return SCC_ERROR_MEMORY_ALLOCATION;
-        }
+    if (result != SCC_SUCCESS) {
+        edge_buffer_free(&buffer);
+        return result;
     }
     
-    // 두 번째 패스: 간선 추가
-    fseek(file, file_pos, SEEK_SET);
-    while (fgets(line, sizeof(line), file)) {
-        char* trimmed = trim_whitespace(line);
-        if (strlen(trimmed) == 0 || trimmed[0] == '#') {
-            continue;
-        }
-        
-        int numbers[1024];
-        int count = parse_integers(trimmed, numbers, 1024);
-        
-        if (count >= 2) {
-            int src = numbers[0];
-            // 첫 번째 숫자는 소스 정점, 나머지는 목적지 정점들
-            for (int i = 1; i < count; i++) {
-                int dest = numbers[i];
-                int result = graph_add_edge(*graph, src, dest);
-                if (result != SCC_SUCCESS && result != SCC_ERROR_EDGE_EXISTS) {
-                    graph_destroy(*graph);
-                    *graph = NULL;
-                    return result;
-                }
-            }
-        }
+    csr_graph_t* csr = edge_buffer_to_csr(&buffer, parser.max_vertex + 1);
+    if (!csr) {
+        return scc_get_last_error();
     }
     
-    return SCC_SUCCESS;
+    *graph = graph_from_csr(csr);
+    csr_graph_destroy(csr);
+    return *graph ? SCC_SUCCESS : scc_get_last_error();
 }
 
 // 간선 리스트 형식 저장
@@ -221,17 +347,7 @@ static int save_edge_list_format(const graph_t* graph, FILE* file) {
             graph_get_vertex_count(graph), graph_get_edge_count(graph));
     fprintf(file, "\n");
     
-    for (int src = 0; src < graph_get_vertex_count(graph); src++) {
-        vertex_t* vertex = graph->vertices[src];
-        edge_t* edge = vertex->edges;
-        
-        while (edge) {
-            fprintf(file, "%d %d\n", src, edge->dest);
-            edge = edge->next;
-        }
-    }
-    
-    return SCC_SUCCESS;
+    return write_text_section(graph, file, TEXT_SECTION_EDGE_LIST);
 }
 
 // 인접 리스트 형식 저장
@@ -242,26 +358,10 @@ static int save_adjacency_list_format(const graph_t* graph, FILE* file) {
             graph_get_vertex_count(graph), graph_get_edge_count(graph));
     fprintf(file, "\n");
     
-    for (int src = 0; src < graph_get_vertex_count(graph); src++) {
-        vertex_t* vertex = graph->vertices[src];
-        
-        if (vertex->out_degree > 0) {
-            fprintf(file, "%d", src);
-            
-            edge_t* edge = vertex->edges;
-            while (edge) {
-                fprintf(file, " %d", edge->dest);
-                edge = edge->next;
-            }
-            
-            fprintf(file, "\n");
-        }
-    }
-    
-    return SCC_SUCCESS;
+    return write_text_section(graph, file, TEXT_SECTION_ADJACENCY_LIST);
 }
 
-// DOT 형식 저장 (Graphviz용)
+// DOT 형식 저장
 static int save_dot_format(const graph_t* graph, FILE* file) {
     fprintf(file, "digraph G {\n");
     fprintf(file, "  // SCC 그래프 - 정점 수: %d, 간선 수: %d\n", 
@@ -269,21 +369,17 @@ static int save_dot_format(const graph_t* graph, FILE* file) {
     fprintf(file, "  \n");
     
     // 정점 정의 (선택사항)
-    for (int i = 0; i < graph_get_vertex_count(graph); i++) {
-        fprintf(file, "  %d [label=\"%d\"];\n", i, i);
+    int result = write_text_section(graph, file, TEXT_SECTION_DOT_VERTICES);
+    if (result != SCC_SUCCESS) {
+        return result;
     }
     
     fprintf(file, "  \n");
     
     // 간선 정의
-    for (int src = 0; src < graph_get_vertex_count(graph); src++) {
-        vertex_t* vertex = graph->vertices[src];
-        edge_t* edge = vertex->edges;
-        
-        while (edge) {
-            fprintf(file, "  %d -> %d;\n", src, edge->dest);
-            edge = edge->next;
-        }
+    result = write_text_section(graph, file, TEXT_SECTION_DOT_EDGES);
+    if (result != SCC_SUCCESS) {
+        return result;
     }
     
     fprintf(file, "}\n");
@@ -291,41 +387,250 @@ static int save_dot_format(const graph_t* graph, FILE* file) {
     return SCC_SUCCESS;
 }
 
-// 헬퍼 함수들
-static char* trim_whitespace(char* str) {
-    // 앞쪽 공백 제거
-    while (isspace((unsigned char)*str)) str++;
+// 0 ~ 99의 두 자리 문자열
+static const char digit_pairs[] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+static int count_digits(unsigned int value) {
+    if (value < 10) return 1;
+    if (value < 100) return 2;
+    if (value < 1000) return 3;
+    if (value < 10000) return 4;
+    if (value < 100000) return 5;
+    if (value < 1000000) return 6;
+    if (value < 10000000) return 7;
+    if (value < 100000000) return 8;
+    if (value < 1000000000) return 9;
+    return 10;
+}
+
+// 음이 아닌 정수를 out에 쓰고 끝 위치를 반환 (자릿수를 먼저 구해 뒤에서부터 두 자리씩)
+static char* format_int(char* out, int value) {
+    unsigned int v = (unsigned int)value;
+    char* end = out + count_digits(v);
+    char* p = end;
+    while (v >= 100) {
+        unsigned int pair = (v % 100) * 2;
+        v /= 100;
+        p -= 2;
+        p[0] = digit_pairs[pair];
+        p[1] = digit_pairs[pair + 1];
+    }
+    if (v >= 10) {
+        p[-2] = digit_pairs[v * 2];
+        p[-1] = digit_pairs[v * 2 + 1];
+    } else {
+        p[-1] = (char)('0' + v);
+    }
+    return end;
+}
+
+static char* append_literal(char* out, const char* text, size_t length) {
+    memcpy(out, text, length);
+    return out + length;
+}
+
+// 용량을 두 배씩 늘려 extra 바이트를 더 쓸 수 있게 함
+static bool text_buffer_reserve(text_buffer_t* buffer, size_t extra) {
+    if (buffer->length + extra <= buffer->capacity) return true;
+    
+    size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+    while (capacity < buffer->length + extra) capacity *= 2;
+    char* data = scc_realloc(buffer->data, capacity);
+    if (!data) {
+        buffer->failed = true;
+        return false;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+// 정점 [begin, end)에 해당하는 구획 내용을 버퍼에 기록
+// 정점마다 최악의 길이만큼 미리 확보하므로 안쪽 루프에는 용량 검사가 없음
+static void format_vertex_range(const graph_t* graph, int begin, int end,
+                                text_section_t section, text_buffer_t* buffer) {
+    for (int v = begin; v < end; v++) {
+        const vertex_t* vertex = &graph->vertices[v];
+        if (!text_buffer_reserve(buffer, ((size_t)vertex->out_degree + 1) * TEXT_MAX_LINE_BYTES)) {
+            return;
+        }
+        
+        char* out = buffer->data + buffer->length;
+        switch (section) {
+            case TEXT_SECTION_EDGE_LIST:
+                for (const edge_t* edge = vertex->edges; edge; edge = edge->next) {
+                    out = format_int(out, v);
+                    *out++ = ' ';
+                    out = format_int(out, edge->dest);
+                    *out++ = '\n';
+                }
+                break;
+            case TEXT_SECTION_ADJACENCY_LIST:
+                if (vertex->out_degree > 0) {
+                    out = format_int(out, v);
+                    for (const edge_t* edge = vertex->edges; edge; edge = edge->next) {
+                        *out++ = ' ';
+                        out = format_int(out, edge->dest);
+                    }
+                    *out++ = '\n';
+                }
+                break;
+            case TEXT_SECTION_DOT_VERTICES:
+                out = append_literal(out, "  ", 2);
+                out = format_int(out, v);
+                out = append_literal(out, " [label=\"", 9);
+                out = format_int(out, v);
+                out = append_literal(out, "\"];\n", 4);
+                break;
+            case TEXT_SECTION_DOT_EDGES:
+                for (const edge_t* edge = vertex->edges; edge; edge = edge->next) {
+                    out = append_literal(out, "  ", 2);
+                    out = format_int(out, v);
+                    out = append_literal(out, " -> ", 4);
+                    out = format_int(out, edge->dest);
+                    out = append_literal(out, ";\n", 2);
+                }
+                break;
+        }
+        buffer->length = (size_t)(out - buffer->data);
+    }
+}
+
+// 구획을 정점 구간 블록으로 나눠 문자열로 바꾸고 순서대로 기록
+// OpenMP가 있으면 블록 묶음을 스레드들이 나눠 만들고, 기록은 항상 블록 순서대로 한 번씩
+static int write_text_section(const graph_t* graph, FILE* file, text_section_t section) {
+    int num_vertices = graph->num_vertices;
+    
+    // 블록 경계: 간선 수(정점마다 1을 더함)가 TEXT_BLOCK_ITEMS에 이를 때마다 자름
+    int num_blocks = 0;
+    int* bounds = scc_malloc(((size_t)num_vertices + 1) * sizeof(int));
+    if (!bounds) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    bounds[0] = 0;
+    size_t items = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        items += (size_t)graph->vertices[v].out_degree + 1;
+        if (items >= TEXT_BLOCK_ITEMS || v == num_vertices - 1) {
+            bounds[++num_blocks] = v + 1;
+            items = 0;
+        }
+    }
     
-    if (*str == 0) return str; // 모든 문자가 공백
+#ifdef _OPENMP
+    int num_threads = omp_get_max_threads();
+#else
+    int num_threads = 1;
+#endif
+    int group = num_threads * TEXT_BLOCKS_PER_THREAD;
+    text_buffer_t* buffers = scc_calloc((size_t)group, sizeof(text_buffer_t));
+    if (!buffers) {
+        scc_free(bounds);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
     
-    // 뒤쪽 공백 제거
-    char* end = str + strlen(str) - 1;
-    while (end > str && isspace((unsigned char)*end)) end--;
+    int result = SCC_SUCCESS;
+    for (int first = 0; first < num_blocks && result == SCC_SUCCESS; first += group) {
+        int count = num_blocks - first < group ? num_blocks - first : group;
+        
+        GRAPH_IO_OMP(omp parallel for schedule(dynamic, 1) num_threads(num_threads))
+        for (int b = 0; b < count; b++) {
+            buffers[b].length = 0;
+            format_vertex_range(graph, bounds[first + b], bounds[first + b + 1], section, &buffers[b]);
+        }
+        
+        for (int b = 0; b < count && result == SCC_SUCCESS; b++) {
+            if (buffers[b].failed) {
+                scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+                result = SCC_ERROR_MEMORY_ALLOCATION;
+            } else if (buffers[b].length > 0 &&
+                       fwrite(buffers[b].data, 1, buffers[b].length, file) != buffers[b].length) {
+                scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+                result = SCC_ERROR_INVALID_PARAMETER;
+            }
+        }
+    }
     
-    *(end + 1) = 0;
+    for (int b = 0; b < group; b++) {
+        scc_free(buffers[b].data);
+    }
+    scc_free(buffers);
+    scc_free(bounds);
+    return result;
+}
+
+// 헬퍼 함수들
+// 간선 버퍼 (용량은 두 배씩 증가)
+static bool edge_buffer_push(edge_buffer_t* buffer, int src, int dest) {
+    if (buffer->count == buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity * 2 : 1024;
+        int* new_src = scc_realloc(buffer->src, capacity * sizeof(int));
+        if (new_src) buffer->src = new_src;
+        int* new_dst = new_src ? scc_realloc(buffer->dst, capacity * sizeof(int)) : NULL;
+        if (new_dst) buffer->dst = new_dst;
+        if (!new_src || !new_dst) {
+            buffer->failed = true;
+            return false;
+        }
+        
+        buffer->capacity = capacity;
+    }
     
-    return str;
+    buffer->src[buffer->count] = src;
+    buffer->dst[buffer->count] = dest;
+    buffer->count++;
+    return true;
 }
 
-static int parse_integers(const char* line, int* numbers, int max_numbers) {
-    int count = 0;
-    char* str_copy = malloc(strlen(line) + 1);
-    if (!str_copy) return 0;
+// 모은 간선으로 CSR 구성 (계수 → 누적합 → 채우기 → 정점별 정렬/중복 제거)
+// 채운 뒤에는 버퍼가 필요 없으므로 최대 메모리를 줄이기 위해 바로 해제
+static csr_graph_t* edge_buffer_to_csr(edge_buffer_t* buffer, int num_vertices) {
+    if (buffer->failed) {
+        edge_buffer_free(buffer);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
     
-    strcpy(str_copy, line);
+    csr_graph_t* csr = csr_graph_create(num_vertices, (int64_t)buffer->count);
+    int64_t* cursor = csr ? scc_malloc(((size_t)num_vertices + 1) * sizeof(int64_t)) : NULL;
+    if (!cursor) {
+        edge_buffer_free(buffer);
+        csr_graph_destroy(csr);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
     
-    char* token = strtok(str_copy, " \t\n\r");
-    while (token && count < max_numbers) {
-        char* endptr;
-        int num = strtol(token, &endptr, 10);
-        
-        if (*endptr == '\0') { // 전체 토큰이 숫자
-            numbers[count++] = num;
-        }
-        
-        token = strtok(NULL, " \t\n\r");
+    for (size_t e = 0; e < buffer->count; e++) {
+        csr->offsets[buffer->src[e] + 1]++;
+    }
+    for (int v = 0; v < num_vertices; v++) {
+        csr->offsets[v + 1] += csr->offsets[v];
     }
+    memcpy(cursor, csr->offsets, ((size_t)num_vertices + 1) * sizeof(int64_t));
+    for (size_t e = 0; e < buffer->count; e++) {
+        csr->targets[cursor[buffer->src[e]]++] = buffer->dst[e];
+    }
+    
+    scc_free(cursor);
+    edge_buffer_free(buffer);
     
-    free(str_copy);
-    return count;
-}
\ No newline at end of file
+    if (csr_graph_sort_targets(csr, 1) != SCC_SUCCESS) {
+        csr_graph_destroy(csr);
+        return NULL;
+    }
+    return csr;
+}
+
+static void edge_buffer_free(edge_buffer_t* buffer) {
+    scc_free(buffer->src);
+    scc_free(buffer->dst);
+    buffer->src = NULL;
+    buffer->dst = NULL;
+    buffer->count = 0;
+    buffer->capacity = 0;
+    buffer->failed = false;
+}
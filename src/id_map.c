@@ -0,0 +1,162 @@
+#include "graph.h"
+#include "scc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+#define ID_MAP_MIN_SLOTS 1024
+
+// 외부 ID는 연속된 키나 하위 비트가 고정된 해시일 수 있으므로 비트를 섞어서 사용
+static size_t id_map_hash(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return (size_t)key;
+}
+
+// 슬롯 수: 2의 거듭제곱, 부하율 70% 이하
+static size_t id_map_slot_count(size_t expected_ids) {
+    size_t slots = ID_MAP_MIN_SLOTS;
+    while (slots / 10 * 7 < expected_ids && slots <= SIZE_MAX / 2) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+static int* id_map_alloc_slots(size_t num_slots) {
+    int* slots = scc_malloc(num_slots * sizeof(int));
+    if (slots) {
+        // 모든 바이트가 0xFF이면 -1 (빈 칸)
+        memset(slots, 0xFF, num_slots * sizeof(int));
+    }
+    return slots;
+}
+
+scc_id_map_t* scc_id_map_create(size_t expected_ids) {
+    scc_id_map_t* map = scc_malloc(sizeof(scc_id_map_t));
+    if (!map) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    size_t num_slots = id_map_slot_count(expected_ids);
+    size_t capacity = expected_ids > 16 ? expected_ids : 16;
+    if (capacity > INT_MAX) capacity = INT_MAX;
+
+    map->slots = id_map_alloc_slots(num_slots);
+    map->external_ids = scc_malloc(capacity * sizeof(uint64_t));
+    if (!map->slots || !map->external_ids) {
+        scc_free(map->slots);
+        scc_free(map->external_ids);
+        scc_free(map);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    map->mask = num_slots - 1;
+    map->count = 0;
+    map->capacity = (int)capacity;
+    return map;
+}
+
+void scc_id_map_destroy(scc_id_map_t* map) {
+    if (!map) return;
+
+    scc_free(map->slots);
+    scc_free(map->external_ids);
+    scc_free(map);
+}
+
+// 슬롯 배열을 두 배로 늘리고 역방향 배열에서 다시 채움 (키를 슬롯에 두지 않으므로)
+static bool id_map_grow_slots(scc_id_map_t* map) {
+    size_t num_slots = (map->mask + 1) * 2;
+    int* slots = id_map_alloc_slots(num_slots);
+    if (!slots) return false;
+
+    size_t mask = num_slots - 1;
+    for (int id = 0; id < map->count; id++) {
+        size_t pos = id_map_hash(map->external_ids[id]) & mask;
+        while (slots[pos] >= 0) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = id;
+    }
+
+    scc_free(map->slots);
+    map->slots = slots;
+    map->mask = mask;
+    return true;
+}
+
+int scc_id_map_find(const scc_id_map_t* map, uint64_t external_id) {
+    if (!map) return -1;
+
+    size_t pos = id_map_hash(external_id) & map->mask;
+    int id;
+    while ((id = map->slots[pos]) >= 0) {
+        if (map->external_ids[id] == external_id) return id;
+        pos = (pos + 1) & map->mask;
+    }
+    return -1;
+}
+
+// 슬롯에는 내부 ID만 저장하고 키는 external_ids[id]로 비교
+// 슬롯이 4바이트라 3천만 개 규모에서도 테이블이 작게 유지됨
+int scc_id_map_get_or_add(scc_id_map_t* map, uint64_t external_id) {
+    if (!map) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+
+    size_t pos = id_map_hash(external_id) & map->mask;
+    int id;
+    while ((id = map->slots[pos]) >= 0) {
+        if (map->external_ids[id] == external_id) return id;
+        pos = (pos + 1) & map->mask;
+    }
+
+    if (map->count == INT_MAX) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    if (map->count == map->capacity) {
+        int capacity = map->capacity <= INT_MAX / 2 ? map->capacity * 2 : INT_MAX;
+        uint64_t* grown = scc_realloc(map->external_ids, (size_t)capacity * sizeof(uint64_t));
+        if (!grown) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        map->external_ids = grown;
+        map->capacity = capacity;
+    }
+
+    id = map->count++;
+    map->external_ids[id] = external_id;
+    map->slots[pos] = id;
+
+    // 부하율 70%를 넘으면 확장 (새 항목은 이미 기록된 뒤이므로 재배치에 포함됨)
+    if ((size_t)map->count > (map->mask + 1) / 10 * 7 && !id_map_grow_slots(map)) {
+        map->slots[pos] = -1;
+        map->count--;
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    return id;
+}
+
+uint64_t scc_id_map_external(const scc_id_map_t* map, int internal_id) {
+    if (!map || internal_id < 0 || internal_id >= map->count) {
+        scc_set_error(SCC_ERROR_INVALID_VERTEX);
+        return 0;
+    }
+    return map->external_ids[internal_id];
+}
+
+int scc_id_map_count(const scc_id_map_t* map) {
+    return map ? map->count : 0;
+}
@@ -0,0 +1,759 @@
+#include "scc_algorithms.h"
+#include "graph.h"
+#include "scc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+// 슬롯 라벨 간격 (이후 슬롯 사이 삽입을 위한 여유)
+#define SCC_INCREMENTAL_LABEL_GAP ((int64_t)1 << 20)
+// 슬롯 사이에 끼워 넣을 때 유지할 최소 라벨 간격
+#define SCC_INCREMENTAL_MIN_SPACING 64
+
+// 내부 헬퍼 함수들
+static int incremental_ensure_capacity(scc_incremental_t* inc, int required_capacity);
+static int incremental_sync_vertices(scc_incremental_t* inc);
+static int incremental_append_singleton(scc_incremental_t* inc, int vertex);
+static int incremental_alloc_slot(scc_incremental_t* inc);
+static void incremental_unlink_slot(scc_incremental_t* inc, int slot);
+static void incremental_insert_slots_after(scc_incremental_t* inc, int slot, int count);
+static int incremental_next_epoch(scc_incremental_t* inc);
+static int incremental_forward_search(scc_incremental_t* inc, int start, int64_t upper, int epoch);
+static int incremental_backward_search(scc_incremental_t* inc, int start, int64_t lower, int epoch);
+static int incremental_merge(scc_incremental_t* inc, int count);
+static void incremental_reorder(scc_incremental_t* inc, int num_forward, int num_backward,
+                                int merged, int epoch);
+static int incremental_split_component(scc_incremental_t* inc, int component);
+static int incremental_rebuild_result(scc_incremental_t* inc);
+static int incremental_recompute(scc_incremental_t* inc);
+static int compare_order_entries(const void* a, const void* b);
+
+static inline int64_t component_label(const scc_incremental_t* inc, int component) {
+    return inc->slot_label[inc->component_slot[component]];
+}
+
+// 증분 SCC 생성 및 소멸
+scc_incremental_t* scc_incremental_create(int initial_capacity) {
+    if (initial_capacity < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    scc_incremental_t* inc = scc_calloc(1, sizeof(scc_incremental_t));
+    if (!inc) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    inc->graph = graph_create(initial_capacity);
+    inc->reverse = graph_create(initial_capacity);
+    if (!inc->graph || !inc->reverse) {
+        scc_incremental_destroy(inc);
+        return NULL;
+    }
+
+    inc->order_head = -1;
+    inc->order_tail = -1;
+    inc->preferred_algorithm = SCC_INCREMENTAL_AUTO;
+
+    if (incremental_ensure_capacity(inc, inc->graph->capacity) != SCC_SUCCESS) {
+        scc_incremental_destroy(inc);
+        return NULL;
+    }
+
+    return inc;
+}
+
+void scc_incremental_destroy(scc_incremental_t* scc_inc) {
+    if (!scc_inc) return;
+
+    scc_free(scc_inc->order_scratch);
+    scc_free(scc_inc->local_index);
+    scc_free(scc_inc->merge_list);
+    scc_free(scc_inc->backward_list);
+    scc_free(scc_inc->forward_list);
+    scc_free(scc_inc->search_stack);
+    scc_free(scc_inc->backward_mark);
+    scc_free(scc_inc->forward_mark);
+    scc_free(scc_inc->free_slots);
+    scc_free(scc_inc->slot_component);
+    scc_free(scc_inc->slot_next);
+    scc_free(scc_inc->slot_prev);
+    scc_free(scc_inc->slot_label);
+    scc_free(scc_inc->component_slot);
+    scc_free(scc_inc->component_size);
+    scc_free(scc_inc->component_tail);
+    scc_free(scc_inc->component_head);
+    scc_free(scc_inc->next_member);
+    scc_free(scc_inc->vertex_component);
+
+    scc_result_destroy(scc_inc->current_result);
+    graph_destroy(scc_inc->reverse);
+    graph_destroy(scc_inc->graph);
+    scc_free(scc_inc);
+}
+
+// 새 정점은 순서의 맨 끝에 단일 컴포넌트로 추가됨: O(1)
+int scc_incremental_add_vertex(scc_incremental_t* scc_inc) {
+    if (!scc_inc) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return -1;
+    }
+
+    int vertex = graph_add_vertex(scc_inc->graph);
+    if (vertex < 0) {
+        return -1;
+    }
+
+    if (incremental_sync_vertices(scc_inc) != SCC_SUCCESS) {
+        return -1;
+    }
+
+    return vertex;
+}
+
+// 간선 삽입
+// 위상 순서를 지키는 간선은 라벨 비교 한 번으로 끝나고,
+// 순서를 어기는 간선은 두 라벨 사이의 컴포넌트만 탐색하여
+// 새로 생긴 사이클 위의 컴포넌트만 병합함
+int scc_incremental_add_edge(scc_incremental_t* scc_inc, int src, int dest) {
+    if (!scc_inc) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+
+    int status = incremental_sync_vertices(scc_inc);
+    if (status != SCC_SUCCESS) {
+        return status;
+    }
+
+    status = graph_add_edge(scc_inc->graph, src, dest);
+    if (status != SCC_SUCCESS) {
+        return status;
+    }
+
+    status = graph_add_edge(scc_inc->reverse, dest, src);
+    if (status != SCC_SUCCESS) {
+        graph_remove_edge(scc_inc->graph, src, dest);
+        return status;
+    }
+
+    int cu = scc_inc->vertex_component[src];
+    int cv = scc_inc->vertex_component[dest];
+    int64_t upper = component_label(scc_inc, cu);
+    int64_t lower = component_label(scc_inc, cv);
+
+    // 같은 컴포넌트이거나 이미 위상 순서를 지키는 간선
+    if (cu == cv || upper < lower) {
+        return SCC_SUCCESS;
+    }
+
+    int epoch = incremental_next_epoch(scc_inc);
+    int num_forward = incremental_forward_search(scc_inc, cv, upper, epoch);
+    int num_backward = incremental_backward_search(scc_inc, cu, lower, epoch);
+
+    // 사이클에 속한 컴포넌트: 정방향과 역방향 탐색 모두에서 방문됨
+    // cu가 정방향 탐색에 포함될 때만 사이클이 생김
+    int merged = -1;
+    if (scc_inc->forward_mark[cu] == epoch) {
+        int count = 0;
+        for (int i = 0; i < num_forward; i++) {
+            int c = scc_inc->forward_list[i];
+            if (scc_inc->backward_mark[c] == epoch) {
+                scc_inc->merge_list[count++] = c;
+            }
+        }
+        merged = incremental_merge(scc_inc, count);
+    }
+
+    incremental_reorder(scc_inc, num_forward, num_backward, merged, epoch);
+
+    if (merged >= 0) {
+        scc_inc->needs_recomputation = true;
+    }
+
+    return SCC_SUCCESS;
+}
+
+// 간선 삭제
+// 서로 다른 컴포넌트 사이의 간선은 순서를 깨지 않으므로 그대로 둠
+// 한 컴포넌트 내부의 간선은 그 컴포넌트만 쪼갤 수 있으므로
+// 해당 컴포넌트가 유도하는 부분 그래프만 다시 계산함
+int scc_incremental_remove_edge(scc_incremental_t* scc_inc, int src, int dest) {
+    if (!scc_inc) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+
+    int status = incremental_sync_vertices(scc_inc);
+    if (status != SCC_SUCCESS) {
+        return status;
+    }
+
+    status = graph_remove_edge(scc_inc->graph, src, dest);
+    if (status != SCC_SUCCESS) {
+        return status;
+    }
+    graph_remove_edge(scc_inc->reverse, dest, src);
+
+    if (src != dest && scc_inc->vertex_component[src] == scc_inc->vertex_component[dest]) {
+        return incremental_split_component(scc_inc, scc_inc->vertex_component[src]);
+    }
+
+    return SCC_SUCCESS;
+}
+
+// 변경이 없으면 캐시된 결과를 그대로 반환: O(1)
+// 변경이 있으면 위상 순서를 따라 O(V)로 다시 구성
+// 반환된 포인터는 다음 변경 호출 전까지만 유효함
+const scc_result_t* scc_incremental_get_result(scc_incremental_t* scc_inc) {
+    if (!scc_inc) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    if (incremental_sync_vertices(scc_inc) != SCC_SUCCESS) {
+        return NULL;
+    }
+
+    if (scc_inc->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+
+    if (scc_inc->needs_recomputation || !scc_inc->current_result) {
+        if (incremental_rebuild_result(scc_inc) != SCC_SUCCESS) {
+            return NULL;
+        }
+    }
+
+    return scc_inc->current_result;
+}
+
+// 그래프 전체에서 상태를 다시 구성 (graph를 직접 수정한 경우에도 사용)
+void scc_incremental_force_recompute(scc_incremental_t* scc_inc) {
+    if (!scc_inc) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return;
+    }
+
+    incremental_recompute(scc_inc);
+}
+
+bool scc_incremental_needs_update(const scc_incremental_t* scc_inc) {
+    if (!scc_inc) return false;
+    return scc_inc->needs_recomputation;
+}
+
+// 내부 헬퍼 함수들 구현
+
+// 정점, 컴포넌트, 슬롯 배열을 모두 같은 용량으로 확장
+static int incremental_ensure_capacity(scc_incremental_t* inc, int required_capacity) {
+    if (inc->vertex_capacity >= required_capacity) {
+        return SCC_SUCCESS;
+    }
+
+    int new_capacity = inc->vertex_capacity > 0 ? inc->vertex_capacity : 16;
+    while (new_capacity < required_capacity) {
+        new_capacity *= 2;
+    }
+    size_t count = (size_t)new_capacity;
+
+    // 하나씩 늘리므로 중간에 실패해도 기존 내용과 용량은 유효함
+    int** int_arrays[] = {
+        &inc->vertex_component, &inc->next_member,
+        &inc->component_head, &inc->component_tail,
+        &inc->component_size, &inc->component_slot,
+        &inc->slot_prev, &inc->slot_next, &inc->slot_component,
+        &inc->free_slots, &inc->search_stack,
+        &inc->forward_list, &inc->backward_list, &inc->merge_list,
+        &inc->local_index
+    };
+    for (size_t i = 0; i < sizeof(int_arrays) / sizeof(int_arrays[0]); i++) {
+        int* grown = scc_realloc(*int_arrays[i], count * sizeof(int));
+        if (!grown) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        *int_arrays[i] = grown;
+    }
+
+    // 방문 표시는 0으로 채워 현재 epoch와 겹치지 않게 함
+    int** mark_arrays[] = { &inc->forward_mark, &inc->backward_mark };
+    for (size_t i = 0; i < 2; i++) {
+        int* grown = scc_realloc(*mark_arrays[i], count * sizeof(int));
+        if (!grown) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        memset(grown + inc->vertex_capacity, 0,
+               (count - (size_t)inc->vertex_capacity) * sizeof(int));
+        *mark_arrays[i] = grown;
+    }
+
+    int64_t* labels = scc_realloc(inc->slot_label, count * sizeof(int64_t));
+    if (!labels) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    inc->slot_label = labels;
+
+    scc_order_entry_t* scratch = scc_realloc(inc->order_scratch, count * sizeof(scc_order_entry_t));
+    if (!scratch) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    inc->order_scratch = scratch;
+
+    inc->vertex_capacity = new_capacity;
+    return SCC_SUCCESS;
+}
+
+// graph에 직접 추가된 정점을 역방향 그래프와 컴포넌트 구조에 반영
+static int incremental_sync_vertices(scc_incremental_t* inc) {
+    int num_vertices = inc->graph->num_vertices;
+    if (inc->num_vertices == num_vertices) {
+        return SCC_SUCCESS;
+    }
+
+    int status = incremental_ensure_capacity(inc, num_vertices);
+    if (status != SCC_SUCCESS) {
+        return status;
+    }
+
+    if (inc->reverse->num_vertices < num_vertices &&
+        graph_add_vertices(inc->reverse, num_vertices - inc->reverse->num_vertices) < 0) {
+        return scc_get_last_error();
+    }
+
+    while (inc->num_vertices < num_vertices) {
+        status = incremental_append_singleton(inc, inc->num_vertices);
+        if (status != SCC_SUCCESS) {
+            return status;
+        }
+        inc->num_vertices++;
+    }
+
+    inc->needs_recomputation = true;
+    return SCC_SUCCESS;
+}
+
+// 정점 하나짜리 컴포넌트를 순서의 맨 끝에 추가
+static int incremental_append_singleton(scc_incremental_t* inc, int vertex) {
+    int slot = incremental_alloc_slot(inc);
+
+    inc->vertex_component[vertex] = vertex;
+    inc->next_member[vertex] = -1;
+    inc->component_head[vertex] = vertex;
+    inc->component_tail[vertex] = vertex;
+    inc->component_size[vertex] = 1;
+    inc->component_slot[vertex] = slot;
+
+    inc->slot_component[slot] = vertex;
+    inc->slot_prev[slot] = inc->order_tail;
+    inc->slot_next[slot] = -1;
+    inc->slot_label[slot] = (inc->order_tail >= 0 ? inc->slot_label[inc->order_tail] : 0)
+                            + SCC_INCREMENTAL_LABEL_GAP;
+    if (inc->order_tail >= 0) {
+        inc->slot_next[inc->order_tail] = slot;
+    } else {
+        inc->order_head = slot;
+    }
+    inc->order_tail = slot;
+
+    return SCC_SUCCESS;
+}
+
+// 슬롯 수는 컴포넌트 수를 넘지 않으므로 용량 확인이 필요 없음
+static int incremental_alloc_slot(scc_incremental_t* inc) {
+    if (inc->num_free_slots > 0) {
+        return inc->free_slots[--inc->num_free_slots];
+    }
+    return inc->num_slots++;
+}
+
+static void incremental_unlink_slot(scc_incremental_t* inc, int slot) {
+    int prev = inc->slot_prev[slot];
+    int next = inc->slot_next[slot];
+
+    if (prev >= 0) inc->slot_next[prev] = next;
+    else inc->order_head = next;
+    if (next >= 0) inc->slot_prev[next] = prev;
+    else inc->order_tail = prev;
+
+    inc->free_slots[inc->num_free_slots++] = slot;
+}
+
+// slot 바로 뒤에 새 슬롯 count개를 연결
+// 라벨 간격이 부족하면 뒤쪽 슬롯까지 범위를 넓혀 그 범위만 균등하게 다시 매김
+static void incremental_insert_slots_after(scc_incremental_t* inc, int slot, int count) {
+    int last = slot;
+    for (int i = 0; i < count; i++) {
+        int fresh = incremental_alloc_slot(inc);
+        int next = inc->slot_next[last];
+
+        inc->slot_prev[fresh] = last;
+        inc->slot_next[fresh] = next;
+        inc->slot_next[last] = fresh;
+        if (next >= 0) inc->slot_prev[next] = fresh;
+        else inc->order_tail = fresh;
+        last = fresh;
+    }
+
+    int64_t base = inc->slot_label[slot];
+    int span = count + 1;
+    int end = inc->slot_next[last];
+    while (end >= 0 && (inc->slot_label[end] - base) / span < SCC_INCREMENTAL_MIN_SPACING) {
+        span++;
+        end = inc->slot_next[end];
+    }
+
+    int64_t spacing = (end >= 0) ? (inc->slot_label[end] - base) / span : SCC_INCREMENTAL_LABEL_GAP;
+    int s = slot;
+    for (int i = 0; i < span; i++) {
+        inc->slot_label[s] = base + i * spacing;
+        s = inc->slot_next[s];
+    }
+}
+
+static int incremental_next_epoch(scc_incremental_t* inc) {
+    if (inc->search_epoch == INT_MAX) {
+        memset(inc->forward_mark, 0, (size_t)inc->vertex_capacity * sizeof(int));
+        memset(inc->backward_mark, 0, (size_t)inc->vertex_capacity * sizeof(int));
+        inc->search_epoch = 0;
+    }
+    return ++inc->search_epoch;
+}
+
+// 라벨이 upper 이하인 컴포넌트 중 start에서 도달 가능한 것을 forward_list에 수집
+static int incremental_forward_search(scc_incremental_t* inc, int start, int64_t upper, int epoch) {
+    int count = 0;
+    int top = 0;
+
+    inc->forward_mark[start] = epoch;
+    inc->forward_list[count++] = start;
+    inc->search_stack[top++] = start;
+
+    while (top > 0) {
+        int c = inc->search_stack[--top];
+        for (int v = inc->component_head[c]; v >= 0; v = inc->next_member[v]) {
+            for (edge_t* edge = inc->graph->vertices[v].edges; edge; edge = edge->next) {
+                int w = inc->vertex_component[edge->dest];
+                if (inc->forward_mark[w] != epoch && component_label(inc, w) <= upper) {
+                    inc->forward_mark[w] = epoch;
+                    inc->forward_list[count++] = w;
+                    inc->search_stack[top++] = w;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// 라벨이 lower 이상인 컴포넌트 중 start로 도달하는 것을 backward_list에 수집
+static int incremental_backward_search(scc_incremental_t* inc, int start, int64_t lower, int epoch) {
+    int count = 0;
+    int top = 0;
+
+    inc->backward_mark[start] = epoch;
+    inc->backward_list[count++] = start;
+    inc->search_stack[top++] = start;
+
+    while (top > 0) {
+        int c = inc->search_stack[--top];
+        for (int v = inc->component_head[c]; v >= 0; v = inc->next_member[v]) {
+            for (edge_t* edge = inc->reverse->vertices[v].edges; edge; edge = edge->next) {
+                int w = inc->vertex_component[edge->dest];
+                if (inc->backward_mark[w] != epoch && component_label(inc, w) >= lower) {
+                    inc->backward_mark[w] = epoch;
+                    inc->backward_list[count++] = w;
+                    inc->search_stack[top++] = w;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// merge_list의 컴포넌트들을 가장 큰 컴포넌트로 병합하고 대표 정점을 반환
+// 작은 쪽의 정점만 다시 표시하므로 전체 비용은 정점당 O(log V)로 상각됨
+static int incremental_merge(scc_incremental_t* inc, int count) {
+    int target = inc->merge_list[0];
+    for (int i = 1; i < count; i++) {
+        int c = inc->merge_list[i];
+        if (inc->component_size[c] > inc->component_size[target]) {
+            target = c;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        int c = inc->merge_list[i];
+        if (c == target) continue;
+
+        for (int v = inc->component_head[c]; v >= 0; v = inc->next_member[v]) {
+            inc->vertex_component[v] = target;
+        }
+        inc->next_member[inc->component_tail[target]] = inc->component_head[c];
+        inc->component_tail[target] = inc->component_tail[c];
+        inc->component_size[target] += inc->component_size[c];
+
+        inc->component_head[c] = -1;
+        inc->component_tail[c] = -1;
+        inc->component_size[c] = 0;
+    }
+
+    return target;
+}
+
+static int compare_order_entries(const void* a, const void* b) {
+    int64_t la = ((const scc_order_entry_t*)a)->label;
+    int64_t lb = ((const scc_order_entry_t*)b)->label;
+    return (la > lb) - (la < lb);
+}
+
+// 탐색된 컴포넌트들이 쓰던 슬롯을 다시 배정 (Pearce-Kelly)
+// 역방향 집합(사이클 제외)이 낮은 슬롯을, 정방향 집합(사이클 제외)이 높은 슬롯을
+// 각자의 기존 순서대로 차지하고, 병합된 컴포넌트는 그 사이의 슬롯 하나를 가짐
+// 남는 슬롯은 순서 리스트에서 제거됨
+static void incremental_reorder(scc_incremental_t* inc, int num_forward, int num_backward,
+                                int merged, int epoch) {
+    scc_order_entry_t* entries = inc->order_scratch;
+    int num_slots = 0;
+
+    // 두 집합의 슬롯을 라벨 순으로 정렬
+    // 병합으로 사라진 컴포넌트도 component_slot에는 기존 슬롯이 남아 있음
+    for (int i = 0; i < num_forward; i++) {
+        int c = inc->forward_list[i];
+        entries[num_slots].label = component_label(inc, c);
+        entries[num_slots++].id = inc->component_slot[c];
+    }
+    for (int i = 0; i < num_backward; i++) {
+        int c = inc->backward_list[i];
+        if (inc->forward_mark[c] == epoch) continue;
+        entries[num_slots].label = component_label(inc, c);
+        entries[num_slots++].id = inc->component_slot[c];
+    }
+    qsort(entries, num_slots, sizeof(scc_order_entry_t), compare_order_entries);
+
+    // 기존 순서를 유지한 채 앞쪽(역방향 전용)과 뒤쪽(정방향 전용)으로 분리
+    int* before = inc->merge_list;
+    int* after = inc->search_stack;
+    int num_before = 0;
+    int num_after = 0;
+    for (int i = 0; i < num_slots; i++) {
+        int c = inc->slot_component[entries[i].id];
+        bool in_forward = (inc->forward_mark[c] == epoch);
+        bool in_backward = (inc->backward_mark[c] == epoch);
+        if (in_backward && !in_forward) before[num_before++] = c;
+        else if (in_forward && !in_backward) after[num_after++] = c;
+    }
+
+    int next = 0;
+    for (int i = 0; i < num_before; i++) {
+        int slot = entries[next++].id;
+        inc->component_slot[before[i]] = slot;
+        inc->slot_component[slot] = before[i];
+    }
+
+    if (merged >= 0) {
+        int slot = entries[next++].id;
+        inc->component_slot[merged] = slot;
+        inc->slot_component[slot] = merged;
+        int num_merged = num_slots - num_before - num_after;
+        for (int i = 1; i < num_merged; i++) {
+            incremental_unlink_slot(inc, entries[next++].id);
+        }
+    }
+
+    for (int i = 0; i < num_after; i++) {
+        int slot = entries[next++].id;
+        inc->component_slot[after[i]] = slot;
+        inc->slot_component[slot] = after[i];
+    }
+}
+
+// 컴포넌트가 유도하는 부분 그래프를 CSR로 만들어 Tarjan으로 다시 분해
+// 비용은 컴포넌트의 정점과 내부 간선 수에만 비례함
+// 쪼개진 조각들은 원래 컴포넌트 자리에 위상 순서대로 이어 붙임
+static int incremental_split_component(scc_incremental_t* inc, int component) {
+    int size = inc->component_size[component];
+    int* members = inc->merge_list;
+
+    int count = 0;
+    for (int v = inc->component_head[component]; v >= 0; v = inc->next_member[v]) {
+        inc->local_index[v] = count;
+        members[count++] = v;
+    }
+
+    int64_t num_edges = 0;
+    for (int i = 0; i < size; i++) {
+        for (edge_t* edge = inc->graph->vertices[members[i]].edges; edge; edge = edge->next) {
+            if (inc->vertex_component[edge->dest] == component) num_edges++;
+        }
+    }
+
+    csr_graph_t* csr = csr_graph_create(size, num_edges);
+    if (!csr) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    int64_t pos = 0;
+    for (int i = 0; i < size; i++) {
+        for (edge_t* edge = inc->graph->vertices[members[i]].edges; edge; edge = edge->next) {
+            if (inc->vertex_component[edge->dest] == component) {
+                csr->targets[pos++] = inc->local_index[edge->dest];
+            }
+        }
+        csr->offsets[i + 1] = pos;
+    }
+
+    scc_result_t* pieces = scc_find_tarjan_csr(csr);
+    csr_graph_destroy(csr);
+    if (!pieces) {
+        return scc_get_last_error();
+    }
+
+    int num_pieces = pieces->num_components;
+    if (num_pieces > 1) {
+        int slot = inc->component_slot[component];
+        incremental_insert_slots_after(inc, slot, num_pieces - 1);
+
+        inc->component_head[component] = -1;
+        inc->component_tail[component] = -1;
+        inc->component_size[component] = 0;
+
+        // Tarjan은 조각을 역위상 순서로 내놓으므로 뒤에서부터 배치
+        for (int i = 0; i < num_pieces; i++) {
+            int c = num_pieces - 1 - i;
+            int begin = pieces->component_offsets[c];
+            int end = pieces->component_offsets[c + 1];
+            int rep = members[pieces->vertices[begin]];
+
+            for (int j = begin; j < end; j++) {
+                int v = members[pieces->vertices[j]];
+                inc->vertex_component[v] = rep;
+                inc->next_member[v] = (j + 1 < end) ? members[pieces->vertices[j + 1]] : -1;
+            }
+            inc->component_head[rep] = rep;
+            inc->component_tail[rep] = members[pieces->vertices[end - 1]];
+            inc->component_size[rep] = end - begin;
+            inc->component_slot[rep] = slot;
+            inc->slot_component[slot] = rep;
+
+            slot = inc->slot_next[slot];
+        }
+
+        inc->needs_recomputation = true;
+    }
+
+    scc_result_destroy(pieces);
+    return SCC_SUCCESS;
+}
+
+// 위상 순서를 따라 결과를 다시 채움: O(V)
+static int incremental_rebuild_result(scc_incremental_t* inc) {
+    int num_vertices = inc->num_vertices;
+
+    if (inc->current_result && inc->current_result->num_vertices != num_vertices) {
+        scc_result_destroy(inc->current_result);
+        inc->current_result = NULL;
+    }
+    if (!inc->current_result) {
+        inc->current_result = scc_result_create(num_vertices);
+        if (!inc->current_result) {
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    scc_result_t* result = inc->current_result;
+    int pos = 0;
+    int component = 0;
+
+    result->component_offsets[0] = 0;
+    for (int slot = inc->order_head; slot >= 0; slot = inc->slot_next[slot]) {
+        int c = inc->slot_component[slot];
+        for (int v = inc->component_head[c]; v >= 0; v = inc->next_member[v]) {
+            result->vertices[pos++] = v;
+            result->vertex_to_component[v] = component;
+        }
+        result->component_offsets[++component] = pos;
+    }
+    result->num_components = component;
+
+    scc_result_compute_statistics(result);
+    inc->needs_recomputation = false;
+
+    return SCC_SUCCESS;
+}
+
+// 정적 알고리즘으로 컴포넌트와 위상 순서를 처음부터 다시 구성
+// Tarjan은 컴포넌트를 역위상 순서로, Kosaraju는 위상 순서로 내놓음
+static int incremental_recompute(scc_incremental_t* inc) {
+    graph_t* reverse = graph_transpose(inc->graph);
+    if (!reverse) {
+        inc->needs_recomputation = true;
+        return scc_get_last_error();
+    }
+    graph_destroy(inc->reverse);
+    inc->reverse = reverse;
+
+    int num_vertices = inc->graph->num_vertices;
+    int status = incremental_ensure_capacity(inc, num_vertices);
+    if (status != SCC_SUCCESS) {
+        inc->needs_recomputation = true;
+        return status;
+    }
+
+    inc->num_vertices = num_vertices;
+    inc->order_head = -1;
+    inc->order_tail = -1;
+    inc->num_slots = 0;
+    inc->num_free_slots = 0;
+
+    if (num_vertices == 0) {
+        scc_result_destroy(inc->current_result);
+        inc->current_result = NULL;
+        inc->needs_recomputation = false;
+        return SCC_SUCCESS;
+    }
+
+    bool use_kosaraju = (inc->preferred_algorithm == SCC_INCREMENTAL_KOSARAJU);
+    scc_result_t* result = use_kosaraju ? scc_find_kosaraju(inc->graph)
+                                        : scc_find_tarjan(inc->graph);
+    if (!result) {
+        inc->needs_recomputation = true;
+        return scc_get_last_error();
+    }
+
+    int num_components = result->num_components;
+    for (int i = 0; i < num_components; i++) {
+        int c = use_kosaraju ? i : num_components - 1 - i;
+        int begin = result->component_offsets[c];
+        int end = result->component_offsets[c + 1];
+        int rep = result->vertices[begin];
+
+        for (int j = begin; j < end; j++) {
+            int v = result->vertices[j];
+            inc->vertex_component[v] = rep;
+            inc->next_member[v] = (j + 1 < end) ? result->vertices[j + 1] : -1;
+        }
+        inc->component_head[rep] = rep;
+        inc->component_tail[rep] = result->vertices[end - 1];
+        inc->component_size[rep] = end - begin;
+        inc->component_slot[rep] = i;
+
+        inc->slot_component[i] = rep;
+        inc->slot_label[i] = (int64_t)(i + 1) * SCC_INCREMENTAL_LABEL_GAP;
+        inc->slot_prev[i] = i - 1;
+        inc->slot_next[i] = (i + 1 < num_components) ? i + 1 : -1;
+    }
+    inc->order_head = 0;
+    inc->order_tail = num_components - 1;
+    inc->num_slots = num_components;
+
+    // 알고리즘의 결과 버퍼를 재사용하여 위상 순서대로 다시 채움
+    scc_result_destroy(inc->current_result);
+    inc->current_result = result;
+    return incremental_rebuild_result(inc);
+}
@@ -1,12 +1,22 @@
 #include "scc_algorithms.h"
 #include "scc.h"
+#include "graph.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
 // 내부 헬퍼 함수들
-static void kosaraju_dfs_first_recursive(const graph_t* graph, int vertex, kosaraju_state_t* state);
-static void kosaraju_dfs_second_recursive(const graph_t* graph, int vertex, kosaraju_state_t* state);
+static int kosaraju_graph_dfs_first(const graph_t* graph, int root, kosaraju_state_t* state);
+static int kosaraju_graph_dfs_second(const graph_t* graph, int root, kosaraju_state_t* state);
+static int kosaraju_ensure_frame_capacity(kosaraju_state_t* state, int required_capacity);
+static int kosaraju_ensure_edge_frame_capacity(kosaraju_state_t* state, int required_capacity);
+static int kosaraju_csr_dfs_first(const csr_graph_t* csr, int root, kosaraju_state_t* state);
+static int kosaraju_csr_dfs_second(const csr_graph_t* transpose, int root, kosaraju_state_t* state);
+static void kosaraju_begin_component(scc_result_t* result);
+static void kosaraju_append_vertex(kosaraju_state_t* state, int vertex);
+static void kosaraju_end_component(kosaraju_state_t* state);
+static int kosaraju_begin_run(kosaraju_state_t* state, int num_vertices);
+static int kosaraju_prepare_transpose(kosaraju_state_t* state, int num_vertices, int64_t num_edges);
 
 // Kosaraju 상태 관리
 kosaraju_state_t* kosaraju_state_create(int num_vertices) {
@@ -15,7 +25,7 @@ kosaraju_state_t* kosaraju_state_create(int num_vertices) {
         return NULL;
     }
     
-    kosaraju_state_t* state = malloc(sizeof(kosaraju_state_t));
+    kosaraju_state_t* state = scc_malloc(sizeof(kosaraju_state_t));
     if (!state) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
@@ -23,107 +33,119 @@ kosaraju_state_t* kosaraju_state_create(int num_vertices) {
     
     // 완료 순서 배열 초기화
     state->finish_capacity = num_vertices;
-    state->finish_order = malloc(state->finish_capacity * sizeof(int));
+    state->finish_order = scc_malloc(state->finish_capacity * sizeof(int));
     if (!state->finish_order) {
-        free(state);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
     state->finish_index = 0;
-    state->transpose_graph = NULL;
+    state->transpose_csr = NULL;
+    state->transpose_vertex_capacity = 0;
+    state->transpose_edge_capacity = 0;
+    state->stats = NULL;
     state->current_component = 0;
     
-    // 방문 상태 배열들
-    state->visited_first_pass = calloc(num_vertices, sizeof(bool));
-    state->visited_second_pass = calloc(num_vertices, sizeof(bool));
-    if (!state->visited_first_pass || !state->visited_second_pass) {
-        free(state->visited_second_pass);
-        free(state->visited_first_pass);
-        free(state->finish_order);
-        free(state);
+    // DFS 프레임 (필요 시 확장)
+    state->frame_capacity = (num_vertices < 64) ? num_vertices : 64;
+    state->edge_frame_capacity = state->frame_capacity;
+    state->frames = scc_malloc(state->frame_capacity * sizeof(dfs_frame_t));
+    state->edge_frames = scc_malloc(state->edge_frame_capacity * sizeof(edge_frame_t));
+    if (!state->frames || !state->edge_frames) {
+        scc_free(state->edge_frames);
+        scc_free(state->frames);
+        scc_free(state->finish_order);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    // 결과 구조 초기화
-    state->result = malloc(sizeof(scc_result_t));
-    if (!state->result) {
-        free(state->visited_second_pass);
-        free(state->visited_first_pass);
-        free(state->finish_order);
-        free(state);
+    // 방문 상태 배열들
+    state->visited_first_pass = scc_calloc(num_vertices, sizeof(bool));
+    state->visited_second_pass = scc_calloc(num_vertices, sizeof(bool));
+    if (!state->visited_first_pass || !state->visited_second_pass) {
+        scc_free(state->visited_second_pass);
+        scc_free(state->visited_first_pass);
+        scc_free(state->edge_frames);
+        scc_free(state->frames);
+        scc_free(state->finish_order);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    state->result->components = malloc(num_vertices * sizeof(scc_component_t));
-    state->result->vertex_to_component = malloc(num_vertices * sizeof(int));
-    if (!state->result->components || !state->result->vertex_to_component) {
-        free(state->result->vertex_to_component);
-        free(state->result->components);
-        free(state->result);
-        free(state->visited_second_pass);
-        free(state->visited_first_pass);
-        free(state->finish_order);
-        free(state);
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+    // 결과 구조 초기화 (평탄 레이아웃)
+    state->result = scc_result_create(num_vertices);
+    if (!state->result) {
+        scc_free(state->visited_second_pass);
+        scc_free(state->visited_first_pass);
+        scc_free(state->edge_frames);
+        scc_free(state->frames);
+        scc_free(state->finish_order);
+        scc_free(state);
         return NULL;
     }
     
-    // 컴포넌트 초기화
     for (int i = 0; i < num_vertices; i++) {
-        state->result->components[i].vertices = malloc(num_vertices * sizeof(int));
-        if (!state->result->components[i].vertices) {
-            // 이전에 할당된 컴포넌트들 정리
-            for (int j = 0; j < i; j++) {
-                free(state->result->components[j].vertices);
-            }
-            free(state->result->vertex_to_component);
-            free(state->result->components);
-            free(state->result);
-            free(state->visited_second_pass);
-            free(state->visited_first_pass);
-            free(state->finish_order);
-            free(state);
-            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
-            return NULL;
-        }
-        state->result->components[i].size = 0;
-        state->result->components[i].capacity = num_vertices;
         state->result->vertex_to_component[i] = -1;
     }
     
-    state->result->num_components = 0;
-    
     return state;
 }
 
 void kosaraju_state_destroy(kosaraju_state_t* state) {
     if (!state) return;
     
-    if (state->result) {
-        if (state->result->components) {
-            for (int i = 0; i < state->result->num_components; i++) {
-                free(state->result->components[i].vertices);
-            }
-            free(state->result->components);
-        }
-        free(state->result->vertex_to_component);
-        free(state->result);
+    scc_result_destroy(state->result);
+    
+    csr_graph_destroy(state->transpose_csr);
+    
+    scc_free(state->visited_second_pass);
+    scc_free(state->visited_first_pass);
+    scc_free(state->edge_frames);
+    scc_free(state->frames);
+    scc_free(state->finish_order);
+    scc_free(state);
+}
+
+// 정점별 배열을 num_vertices개까지 확장 (줄이지 않음)
+int kosaraju_state_reserve(kosaraju_state_t* state, int num_vertices) {
+    if (!state) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    
+    if (state->finish_capacity >= num_vertices) {
+        return SCC_SUCCESS;
     }
     
-    if (state->transpose_graph) {
-        graph_destroy(state->transpose_graph);
+    int* finish_order = scc_realloc(state->finish_order, num_vertices * sizeof(int));
+    if (!finish_order) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    state->finish_order = finish_order;
+    
+    bool* visited_first = scc_realloc(state->visited_first_pass, num_vertices * sizeof(bool));
+    if (!visited_first) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
     }
+    state->visited_first_pass = visited_first;
     
-    free(state->visited_second_pass);
-    free(state->visited_first_pass);
-    free(state->finish_order);
-    free(state);
+    bool* visited_second = scc_realloc(state->visited_second_pass, num_vertices * sizeof(bool));
+    if (!visited_second) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    state->visited_second_pass = visited_second;
+    
+    state->finish_capacity = num_vertices;
+    return SCC_SUCCESS;
 }
 
-// Kosaraju 알고리즘 메인 구현
+// Kosaraju 알고리즘 메인 구현 (명시적 스택 사용, 재귀 없음)
 scc_result_t* scc_kosaraju_internal(const graph_t* graph, kosaraju_state_t* state) {
     if (!graph || !state) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
@@ -131,49 +153,47 @@ scc_result_t* scc_kosaraju_internal(const graph_t* graph, kosaraju_state_t* stat
     }
     
     int num_vertices = graph_get_vertex_count(graph);
-    if (num_vertices <= 0) {
-        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+    if (kosaraju_begin_run(state, num_vertices) != SCC_SUCCESS) {
         return NULL;
     }
     
     // 1단계: 원본 그래프에서 첫 번째 DFS 수행하여 완료 순서 계산
+    SCC_PHASE_START(state->stats, first_start);
     for (int i = 0; i < num_vertices; i++) {
         if (!state->visited_first_pass[i]) {
-            kosaraju_dfs_first_recursive(graph, i, state);
+            if (kosaraju_graph_dfs_first(graph, i, state) != SCC_SUCCESS) {
+                return NULL;
+            }
         }
     }
+    SCC_PHASE_STOP(state->stats, kosaraju_first_pass_ms, first_start);
     
-    // 2단계: 전치 그래프 생성
-    state->transpose_graph = graph_transpose(graph);
-    if (!state->transpose_graph) {
+    // 2단계: 계수 정렬로 역방향 인접 배열 생성 (간선 중복 검사 없음)
+    SCC_PHASE_START(state->stats, transpose_start);
+    if (kosaraju_prepare_transpose(state, num_vertices, graph->num_edges) != SCC_SUCCESS) {
         return NULL;
     }
+    graph_transpose_csr_fill(graph, state->transpose_csr);
+    SCC_PHASE_STOP(state->stats, transpose_ms, transpose_start);
     
     // 3단계: 전치 그래프에서 완료 순서의 역순으로 두 번째 DFS 수행
+    SCC_PHASE_START(state->stats, second_start);
     for (int i = state->finish_index - 1; i >= 0; i--) {
         int vertex = state->finish_order[i];
         if (!state->visited_second_pass[vertex]) {
-            kosaraju_dfs_second_recursive(state->transpose_graph, vertex, state);
-            state->current_component++;
-            state->result->num_components++;
+            kosaraju_begin_component(state->result);
+            if (kosaraju_csr_dfs_second(state->transpose_csr, vertex, state) != SCC_SUCCESS) {
+                return NULL;
+            }
+            kosaraju_end_component(state);
         }
     }
+    SCC_PHASE_STOP(state->stats, kosaraju_second_pass_ms, second_start);
     
     // 통계 계산
-    int largest = 0, smallest = num_vertices + 1;
-    int total_vertices = 0;
-    
-    for (int i = 0; i < state->result->num_components; i++) {
-        int size = state->result->components[i].size;
-        if (size > largest) largest = size;
-        if (size < smallest) smallest = size;
-        total_vertices += size;
-    }
-    
-    state->result->largest_component_size = largest;
-    state->result->smallest_component_size = (state->result->num_components > 0) ? smallest : 0;
-    state->result->average_component_size = (state->result->num_components > 0) ? 
-        (double)total_vertices / state->result->num_components : 0.0;
+    SCC_PHASE_START(state->stats, statistics_start);
+    scc_result_compute_statistics(state->result);
+    SCC_PHASE_STOP(state->stats, statistics_ms, statistics_start);
     
     // 결과 반환 (상태에서 분리하여 반환)
     scc_result_t* result = state->result;
@@ -183,15 +203,32 @@ scc_result_t* scc_kosaraju_internal(const graph_t* graph, kosaraju_state_t* stat
 }
 
 void kosaraju_dfs_first(const graph_t* graph, int vertex, kosaraju_state_t* state) {
-    kosaraju_dfs_first_recursive(graph, vertex, state);
+    if (!graph || !state || vertex < 0 || vertex >= graph->num_vertices) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return;
+    }
+    kosaraju_graph_dfs_first(graph, vertex, state);
 }
 
+// graph는 이미 전치된 그래프여야 함
 void kosaraju_dfs_second(const graph_t* graph, int vertex, kosaraju_state_t* state) {
-    kosaraju_dfs_second_recursive(graph, vertex, state);
+    if (!graph || !state || !state->result || vertex < 0 || vertex >= graph->num_vertices) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return;
+    }
+    kosaraju_graph_dfs_second(graph, vertex, state);
 }
 
 // 공개 API 함수
 scc_result_t* scc_find_kosaraju(const graph_t* graph) {
+    return scc_find_kosaraju_stats(graph, NULL);
+}
+
+// stats의 총 시간과 할당 수에는 상태 생성과 해제도 포함됨
+scc_result_t* scc_find_kosaraju_stats(const graph_t* graph, scc_stats_t* stats) {
+    scc_profile_run_t run;
+    scc_profile_begin(&run, stats);
+    
     if (!graph) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
         return NULL;
@@ -208,45 +245,377 @@ scc_result_t* scc_find_kosaraju(const graph_t* graph) {
         return NULL;
     }
     
+    state->stats = stats;
     scc_result_t* result = scc_kosaraju_internal(graph, state);
     kosaraju_state_destroy(state);
     
+    scc_profile_end(&run, stats);
+    return result;
+}
+
+// CSR 그래프 위의 Kosaraju 알고리즘 (명시적 스택 사용)
+scc_result_t* scc_kosaraju_csr_internal(const csr_graph_t* csr, kosaraju_state_t* state) {
+    if (!csr || !state) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    int num_vertices = csr->num_vertices;
+    if (kosaraju_begin_run(state, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    
+    // 1단계: 완료 순서 계산
+    SCC_PHASE_START(state->stats, first_start);
+    for (int i = 0; i < num_vertices; i++) {
+        if (!state->visited_first_pass[i]) {
+            if (kosaraju_csr_dfs_first(csr, i, state) != SCC_SUCCESS) {
+                return NULL;
+            }
+        }
+    }
+    SCC_PHASE_STOP(state->stats, kosaraju_first_pass_ms, first_start);
+    
+    // 2단계: 계수 정렬로 전치 그래프 생성
+    SCC_PHASE_START(state->stats, transpose_start);
+    if (kosaraju_prepare_transpose(state, num_vertices, csr->num_edges) != SCC_SUCCESS) {
+        return NULL;
+    }
+    csr_graph_transpose_fill(csr, state->transpose_csr);
+    SCC_PHASE_STOP(state->stats, transpose_ms, transpose_start);
+    
+    // 3단계: 완료 순서의 역순으로 전치 그래프 탐색
+    SCC_PHASE_START(state->stats, second_start);
+    for (int i = state->finish_index - 1; i >= 0; i--) {
+        int vertex = state->finish_order[i];
+        if (!state->visited_second_pass[vertex]) {
+            kosaraju_begin_component(state->result);
+            if (kosaraju_csr_dfs_second(state->transpose_csr, vertex, state) != SCC_SUCCESS) {
+                return NULL;
+            }
+            kosaraju_end_component(state);
+        }
+    }
+    SCC_PHASE_STOP(state->stats, kosaraju_second_pass_ms, second_start);
+    
+    SCC_PHASE_START(state->stats, statistics_start);
+    scc_result_compute_statistics(state->result);
+    SCC_PHASE_STOP(state->stats, statistics_ms, statistics_start);
+    
+    // 결과 반환 (상태에서 분리하여 반환)
+    scc_result_t* result = state->result;
+    state->result = NULL; // 이중 해제 방지
+    
+    return result;
+}
+
+scc_result_t* scc_find_kosaraju_csr(const csr_graph_t* csr) {
+    return scc_find_kosaraju_csr_stats(csr, NULL);
+}
+
+scc_result_t* scc_find_kosaraju_csr_stats(const csr_graph_t* csr, scc_stats_t* stats) {
+    scc_profile_run_t run;
+    scc_profile_begin(&run, stats);
+    
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    if (csr->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    kosaraju_state_t* state = kosaraju_state_create(csr->num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    state->stats = stats;
+    scc_result_t* result = scc_kosaraju_csr_internal(csr, state);
+    kosaraju_state_destroy(state);
+    
+    scc_profile_end(&run, stats);
     return result;
 }
 
 // 내부 헬퍼 함수들 구현
-static void kosaraju_dfs_first_recursive(const graph_t* graph, int vertex, kosaraju_state_t* state) {
-    state->visited_first_pass[vertex] = true;
+
+// 실행 시작 전 상태 초기화 (tarjan_begin_run과 같은 규칙)
+static int kosaraju_begin_run(kosaraju_state_t* state, int num_vertices) {
+    if (num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return SCC_ERROR_GRAPH_EMPTY;
+    }
+    
+    if (num_vertices > state->finish_capacity) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+    
+    if (!state->result) {
+        state->result = scc_result_create(num_vertices);
+        if (!state->result) {
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+    state->result->num_vertices = num_vertices;
+    state->result->num_components = 0;
+    state->result->component_offsets[0] = 0;
+    
+    memset(state->visited_first_pass, 0, num_vertices * sizeof(bool));
+    memset(state->visited_second_pass, 0, num_vertices * sizeof(bool));
+    state->finish_index = 0;
+    state->current_component = 0;
+    
+    return SCC_SUCCESS;
+}
+
+// 전치 그래프 버퍼를 재사용하고 부족할 때만 확장
+static int kosaraju_prepare_transpose(kosaraju_state_t* state, int num_vertices, int64_t num_edges) {
+    if (!state->transpose_csr) {
+        state->transpose_csr = csr_graph_create(num_vertices, num_edges);
+        if (!state->transpose_csr) {
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        state->transpose_vertex_capacity = num_vertices;
+        state->transpose_edge_capacity = num_edges;
+        return SCC_SUCCESS;
+    }
+    
+    csr_graph_t* transpose = state->transpose_csr;
+    if (num_vertices > state->transpose_vertex_capacity) {
+        int64_t* offsets = scc_realloc(transpose->offsets, ((size_t)num_vertices + 1) * sizeof(int64_t));
+        if (!offsets) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        transpose->offsets = offsets;
+        state->transpose_vertex_capacity = num_vertices;
+    }
+    if (num_edges > state->transpose_edge_capacity) {
+        int* targets = scc_realloc(transpose->targets, (size_t)num_edges * sizeof(int));
+        if (!targets) {
+            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+            return SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        transpose->targets = targets;
+        state->transpose_edge_capacity = num_edges;
+    }
+    
+    return SCC_SUCCESS;
+}
+
+static int kosaraju_ensure_frame_capacity(kosaraju_state_t* state, int required_capacity) {
+    if (state->frame_capacity >= required_capacity) {
+        return SCC_SUCCESS;
+    }
+    
+    int new_capacity = state->frame_capacity > 0 ? state->frame_capacity : 64;
+    while (new_capacity < required_capacity) new_capacity *= 2;
+    
+    dfs_frame_t* new_frames = scc_realloc(state->frames, new_capacity * sizeof(dfs_frame_t));
+    if (!new_frames) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
     
-    vertex_t* v = graph->vertices[vertex];
-    edge_t* edge = v->edges;
+    state->frames = new_frames;
+    state->frame_capacity = new_capacity;
     
-    while (edge) {
-        if (!state->visited_first_pass[edge->dest]) {
-            kosaraju_dfs_first_recursive(graph, edge->dest, state);
+    return SCC_SUCCESS;
+}
+
+static int kosaraju_ensure_edge_frame_capacity(kosaraju_state_t* state, int required_capacity) {
+    if (state->edge_frame_capacity >= required_capacity) {
+        return SCC_SUCCESS;
+    }
+    
+    int new_capacity = state->edge_frame_capacity > 0 ? state->edge_frame_capacity : 64;
+    while (new_capacity < required_capacity) new_capacity *= 2;
+    
+    edge_frame_t* new_frames = scc_realloc(state->edge_frames, new_capacity * sizeof(edge_frame_t));
+    if (!new_frames) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    state->edge_frames = new_frames;
+    state->edge_frame_capacity = new_capacity;
+    
+    return SCC_SUCCESS;
+}
+
+// 연결 리스트 그래프의 첫 번째 패스: 간선 포인터 커서를 가진 프레임으로 후위 순서 기록
+static int kosaraju_graph_dfs_first(const graph_t* graph, int root, kosaraju_state_t* state) {
+    const vertex_t* vertices = graph->vertices;
+    bool* visited = state->visited_first_pass;
+    int depth = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1; int max_depth = 1;)
+    
+    if (kosaraju_ensure_edge_frame_capacity(state, 1) != SCC_SUCCESS) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    visited[root] = true;
+    state->edge_frames[depth].vertex = root;
+    state->edge_frames[depth].next_edge = vertices[root].edges;
+    depth++;
+    
+    while (depth > 0) {
+        edge_frame_t* frame = &state->edge_frames[depth - 1];
+        const edge_t* edge = frame->next_edge;
+        
+        if (edge) {
+            int w = edge->dest;
+            frame->next_edge = edge->next;
+            SCC_PROFILE(edges_scanned++;)
+            if (!visited[w]) {
+                if (kosaraju_ensure_edge_frame_capacity(state, depth + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                visited[w] = true;
+                state->edge_frames[depth].vertex = w;
+                state->edge_frames[depth].next_edge = vertices[w].edges;
+                depth++;
+                SCC_PROFILE(pushes++; if (depth > max_depth) max_depth = depth;)
+            }
+            continue;
         }
-        edge = edge->next;
+        
+        // 완료 시간 순서로 기록 (후위 순서)
+        state->finish_order[state->finish_index++] = frame->vertex;
+        depth--;
     }
     
-    // 완료 시간 순서로 기록 (후위 순서)
-    state->finish_order[state->finish_index++] = vertex;
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, max_depth);)
+    return SCC_SUCCESS;
 }
 
-static void kosaraju_dfs_second_recursive(const graph_t* graph, int vertex, kosaraju_state_t* state) {
-    state->visited_second_pass[vertex] = true;
+// 연결 리스트로 된 전치 그래프의 두 번째 패스 (프레임 배열을 단순 스택으로 사용)
+static int kosaraju_graph_dfs_second(const graph_t* graph, int root, kosaraju_state_t* state) {
+    bool* visited = state->visited_second_pass;
+    int top = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1;)
     
-    // 현재 컴포넌트에 정점 추가
-    scc_component_t* component = &state->result->components[state->current_component];
-    component->vertices[component->size++] = vertex;
-    state->result->vertex_to_component[vertex] = state->current_component;
+    if (kosaraju_ensure_frame_capacity(state, 1) != SCC_SUCCESS) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
     
-    vertex_t* v = graph->vertices[vertex];
-    edge_t* edge = v->edges;
+    visited[root] = true;
+    state->frames[top++].vertex = root;
     
-    while (edge) {
-        if (!state->visited_second_pass[edge->dest]) {
-            kosaraju_dfs_second_recursive(graph, edge->dest, state);
+    while (top > 0) {
+        int v = state->frames[--top].vertex;
+        kosaraju_append_vertex(state, v);
+        
+        for (const edge_t* edge = graph->vertices[v].edges; edge; edge = edge->next) {
+            int w = edge->dest;
+            SCC_PROFILE(edges_scanned++;)
+            if (!visited[w]) {
+                if (kosaraju_ensure_frame_capacity(state, top + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                visited[w] = true;
+                state->frames[top++].vertex = w;
+                SCC_PROFILE(pushes++;)
+            }
         }
-        edge = edge->next;
     }
-}
\ No newline at end of file
+    
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, 0);)
+    return SCC_SUCCESS;
+}
+
+// 첫 번째 패스: 간선 커서를 가진 프레임으로 후위 순서 기록
+static int kosaraju_csr_dfs_first(const csr_graph_t* csr, int root, kosaraju_state_t* state) {
+    const int64_t* offsets = csr->offsets;
+    const int* targets = csr->targets;
+    bool* visited = state->visited_first_pass;
+    int depth = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1; int max_depth = 1;)
+    
+    visited[root] = true;
+    state->frames[depth].vertex = root;
+    state->frames[depth].next_edge = offsets[root];
+    depth++;
+    
+    while (depth > 0) {
+        dfs_frame_t* frame = &state->frames[depth - 1];
+        int v = frame->vertex;
+        
+        if (frame->next_edge < offsets[v + 1]) {
+            int w = targets[frame->next_edge++];
+            SCC_PROFILE(edges_scanned++;)
+            if (!visited[w]) {
+                if (kosaraju_ensure_frame_capacity(state, depth + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                visited[w] = true;
+                state->frames[depth].vertex = w;
+                state->frames[depth].next_edge = offsets[w];
+                depth++;
+                SCC_PROFILE(pushes++; if (depth > max_depth) max_depth = depth;)
+            }
+            continue;
+        }
+        
+        // 완료 시간 순서로 기록 (후위 순서)
+        state->finish_order[state->finish_index++] = v;
+        depth--;
+    }
+    
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, max_depth);)
+    return SCC_SUCCESS;
+}
+
+// 두 번째 패스: 컴포넌트 내 정점 순서는 무관하므로 프레임 배열을 단순 스택으로 사용
+// push 시점에 방문 표시하므로 스택 깊이는 정점 수를 넘지 않음
+static int kosaraju_csr_dfs_second(const csr_graph_t* transpose, int root, kosaraju_state_t* state) {
+    bool* visited = state->visited_second_pass;
+    int top = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1;)
+    
+    visited[root] = true;
+    state->frames[top++].vertex = root;
+    
+    while (top > 0) {
+        int v = state->frames[--top].vertex;
+        kosaraju_append_vertex(state, v);
+        
+        for (int64_t e = transpose->offsets[v]; e < transpose->offsets[v + 1]; e++) {
+            int w = transpose->targets[e];
+            SCC_PROFILE(edges_scanned++;)
+            if (!visited[w]) {
+                if (kosaraju_ensure_frame_capacity(state, top + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                visited[w] = true;
+                state->frames[top++].vertex = w;
+                SCC_PROFILE(pushes++;)
+            }
+        }
+    }
+    
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, 0);)
+    return SCC_SUCCESS;
+}
+
+// 두 번째 패스의 컴포넌트 구성: component_offsets[num_components + 1]을
+// 진행 중인 컴포넌트의 끝 위치로 사용하여 정점 배열을 한 번에 채움
+static void kosaraju_begin_component(scc_result_t* result) {
+    result->component_offsets[result->num_components + 1] =
+        result->component_offsets[result->num_components];
+}
+
+static void kosaraju_append_vertex(kosaraju_state_t* state, int vertex) {
+    scc_result_t* result = state->result;
+    result->vertices[result->component_offsets[result->num_components + 1]++] = vertex;
+    result->vertex_to_component[vertex] = state->current_component;
+}
+
+static void kosaraju_end_component(kosaraju_state_t* state) {
+    state->current_component++;
+    state->result->num_components++;
+}
@@ -1,11 +1,20 @@
 #include "graph.h"
 #include "scc.h"
+#include "scc_algorithms.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stdint.h>
+
+// 스레드 로컬 저장소 지정자 (C99에는 thread_local 키워드가 없음)
+#if defined(_MSC_VER)
+#define SCC_THREAD_LOCAL __declspec(thread)
+#else
+#define SCC_THREAD_LOCAL __thread
+#endif
 
 // 전역 오류 상태
-static thread_local scc_error_t last_error = SCC_SUCCESS;
+static SCC_THREAD_LOCAL scc_error_t last_error = SCC_SUCCESS;
 
 // 오류 처리 함수들
 void scc_set_error(scc_error_t error) {
@@ -36,117 +45,304 @@ const char* scc_error_string(scc_error_t error) {
     return error_messages[-error];
 }
 
-// 메모리 풀 구현
+// 계측 할당기: 블록 앞에 요청 크기를 적은 헤더를 두어 현재/최대 사용량을 정확히 셈
+// 헤더를 16바이트로 두어 malloc이 보장하는 정렬을 그대로 유지
+#define ALLOCATION_HEADER_BYTES 16
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MEMORY_FETCH_ADD_INT64(ptr, value) _InterlockedExchangeAdd64((volatile __int64*)(ptr), (value))
+#define MEMORY_CAS_INT64(ptr, expected, desired) \
+    _InterlockedCompareExchange64((volatile __int64*)(ptr), (desired), (expected))
+#else
+#define MEMORY_FETCH_ADD_INT64(ptr, value) __sync_fetch_and_add((ptr), (value))
+#define MEMORY_CAS_INT64(ptr, expected, desired) __sync_val_compare_and_swap((ptr), (expected), (desired))
+#endif
+
+// 모든 스레드가 공유하는 사용량 (병렬 알고리즘의 작업 스레드 할당도 포함)
+static volatile int64_t memory_current_bytes = 0;
+static volatile int64_t memory_peak_bytes = 0;
+
+#ifdef SCC_ENABLE_PROFILING
+// 누적 할당 호출 수와 요청 바이트 (scc_stats_t용, 해제해도 줄지 않음)
+static volatile int64_t memory_allocation_count = 0;
+static volatile int64_t memory_allocated_bytes = 0;
+
+static void memory_count_allocation(int64_t bytes) {
+    MEMORY_FETCH_ADD_INT64(&memory_allocation_count, 1);
+    if (bytes > 0) MEMORY_FETCH_ADD_INT64(&memory_allocated_bytes, bytes);
+}
+#define MEMORY_COUNT_ALLOCATION(bytes) memory_count_allocation(bytes)
+#else
+#define MEMORY_COUNT_ALLOCATION(bytes) ((void)0)
+#endif
+
+static void memory_account(int64_t delta) {
+    int64_t current = MEMORY_FETCH_ADD_INT64(&memory_current_bytes, delta) + delta;
+    if (delta <= 0) return;
+
+    int64_t peak = memory_peak_bytes;
+    while (current > peak) {
+        int64_t seen = MEMORY_CAS_INT64(&memory_peak_bytes, peak, current);
+        if (seen == peak) break;
+        peak = seen;
+    }
+}
+
+void* scc_malloc(size_t size) {
+    if (size > SIZE_MAX - ALLOCATION_HEADER_BYTES) return NULL;
+
+    char* block = malloc(size + ALLOCATION_HEADER_BYTES);
+    if (!block) return NULL;
+
+    *(size_t*)block = size;
+    memory_account((int64_t)size);
+    MEMORY_COUNT_ALLOCATION((int64_t)size);
+    return block + ALLOCATION_HEADER_BYTES;
+}
+
+void* scc_calloc(size_t count, size_t size) {
+    if (size != 0 && count > (SIZE_MAX - ALLOCATION_HEADER_BYTES) / size) return NULL;
+
+    char* block = calloc(1, count * size + ALLOCATION_HEADER_BYTES);
+    if (!block) return NULL;
+
+    *(size_t*)block = count * size;
+    memory_account((int64_t)(count * size));
+    MEMORY_COUNT_ALLOCATION((int64_t)(count * size));
+    return block + ALLOCATION_HEADER_BYTES;
+}
+
+// 실패하면 원래 블록과 사용량은 그대로 유지됨
+void* scc_realloc(void* ptr, size_t size) {
+    if (!ptr) return scc_malloc(size);
+    if (size > SIZE_MAX - ALLOCATION_HEADER_BYTES) return NULL;
+
+    char* block = (char*)ptr - ALLOCATION_HEADER_BYTES;
+    size_t old_size = *(size_t*)block;
+    char* grown = realloc(block, size + ALLOCATION_HEADER_BYTES);
+    if (!grown) return NULL;
+
+    *(size_t*)grown = size;
+    memory_account((int64_t)size - (int64_t)old_size);
+    MEMORY_COUNT_ALLOCATION((int64_t)size - (int64_t)old_size);
+    return grown + ALLOCATION_HEADER_BYTES;
+}
+
+void scc_free(void* ptr) {
+    if (!ptr) return;
+
+    char* block = (char*)ptr - ALLOCATION_HEADER_BYTES;
+    memory_account(-(int64_t)*(size_t*)block);
+    free(block);
+}
+
+size_t scc_memory_current_bytes(void) {
+    return (size_t)memory_current_bytes;
+}
+
+size_t scc_memory_peak_bytes(void) {
+    return (size_t)memory_peak_bytes;
+}
+
+int64_t scc_memory_allocation_count(void) {
+#ifdef SCC_ENABLE_PROFILING
+    return memory_allocation_count;
+#else
+    return 0;
+#endif
+}
+
+int64_t scc_memory_allocated_bytes(void) {
+#ifdef SCC_ENABLE_PROFILING
+    return memory_allocated_bytes;
+#else
+    return 0;
+#endif
+}
+
+// 최대값을 현재 사용량으로 되돌림 (다른 스레드의 동시 할당은 이후 최대값에 반영됨)
+void scc_memory_reset_peak(void) {
+    int64_t peak = memory_peak_bytes;
+    for (;;) {
+        int64_t seen = MEMORY_CAS_INT64(&memory_peak_bytes, peak, memory_current_bytes);
+        if (seen == peak) break;
+        peak = seen;
+    }
+}
+
+// 메모리 풀 구현 (고정 크기 슬랩 할당기)
+// 청크 하나에 같은 크기의 객체를 연속으로 담고, 해제된 객체는
+// 객체 자신의 첫 워드를 링크로 쓰는 침투형 free list에 넣음
+#define MEMORY_POOL_MIN_CHUNK_OBJECTS 16
+#define MEMORY_POOL_MAX_CHUNK_OBJECTS (1 << 20)
+#define MEMORY_POOL_FIRST_CHUNK_BYTES 4096
+
+// 청크 헤더 뒤 첫 번째 정렬된 객체 위치
+static char* chunk_data(const memory_pool_t* pool, memory_chunk_t* chunk) {
+    uintptr_t start = (uintptr_t)(chunk + 1);
+    return (char*)((start + pool->alignment - 1) & ~(uintptr_t)(pool->alignment - 1));
+}
+
+static bool pool_add_chunk(memory_pool_t* pool) {
+    size_t capacity = pool->next_chunk_capacity;
+    size_t bytes = sizeof(memory_chunk_t) + pool->alignment + capacity * pool->block_size;
+
+    memory_chunk_t* chunk = scc_malloc(bytes);
+    if (!chunk) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return false;
+    }
+
+    chunk->capacity = capacity;
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+
+    pool->bump = chunk_data(pool, chunk);
+    pool->bump_end = pool->bump + capacity * pool->block_size;
+    pool->total_allocated += capacity * pool->block_size;
+
+    // 청크 수가 객체 수의 로그에 비례하도록 다음 청크를 두 배로
+    if (pool->next_chunk_capacity < MEMORY_POOL_MAX_CHUNK_OBJECTS) {
+        pool->next_chunk_capacity *= 2;
+    }
+    return true;
+}
+
 memory_pool_t* memory_pool_create(size_t block_size, size_t alignment) {
     if (block_size == 0 || alignment == 0) {
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
         return NULL;
     }
     
-    // alignment를 2의 거듭제곱으로 조정
-    size_t align = 1;
+    // alignment를 2의 거듭제곱으로 조정 (free list 링크를 담을 수 있어야 함)
+    size_t align = sizeof(void*);
     while (align < alignment) align <<= 1;
     
-    memory_pool_t* pool = malloc(sizeof(memory_pool_t));
+    memory_pool_t* pool = scc_malloc(sizeof(memory_pool_t));
     if (!pool) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    pool->blocks = NULL;
-    pool->block_size = block_size;
+    // 슬롯 크기: 링크 포인터 이상, alignment의 배수
+    size_t slot = block_size < sizeof(void*) ? sizeof(void*) : block_size;
+    slot = (slot + align - 1) & ~(align - 1);
+
+    size_t first = MEMORY_POOL_FIRST_CHUNK_BYTES / slot;
+    
+    pool->free_list = NULL;
+    pool->chunks = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->block_size = slot;
+    pool->alignment = align;
+    pool->next_chunk_capacity = first < MEMORY_POOL_MIN_CHUNK_OBJECTS ? MEMORY_POOL_MIN_CHUNK_OBJECTS : first;
     pool->total_allocated = 0;
     pool->total_used = 0;
-    pool->alignment = align;
     
     return pool;
 }
 
+// 다음 count번의 할당이 malloc 없이 이루어지도록 보장
+// 현재 청크의 남은 공간이 부족하면 그 공간은 free list로 넘기고
+// count개를 담는 청크 하나를 새로 만듦
+int memory_pool_reserve(memory_pool_t* pool, size_t count) {
+    if (!pool) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    
+    size_t available = (size_t)(pool->bump_end - pool->bump) / pool->block_size;
+    if (available >= count) {
+        return SCC_SUCCESS;
+    }
+    
+    while (pool->bump != pool->bump_end) {
+        *(void**)pool->bump = pool->free_list;
+        pool->free_list = pool->bump;
+        pool->bump += pool->block_size;
+    }
+    
+    size_t next = pool->next_chunk_capacity;
+    if (count > next) {
+        pool->next_chunk_capacity = count;
+    }
+    bool added = pool_add_chunk(pool);
+    if (count > next) {
+        pool->next_chunk_capacity = next;
+    }
+    
+    return added ? SCC_SUCCESS : SCC_ERROR_MEMORY_ALLOCATION;
+}
+
+// 청크 단위로만 해제하므로 개별 객체 수와 무관
 void memory_pool_destroy(memory_pool_t* pool) {
     if (!pool) return;
     
-    memory_block_t* block = pool->blocks;
-    while (block) {
-        memory_block_t* next = block->next;
-        free(block->data);
-        free(block);
-        block = next;
+    memory_chunk_t* chunk = pool->chunks;
+    while (chunk) {
+        memory_chunk_t* next = chunk->next;
+        scc_free(chunk);
+        chunk = next;
     }
     
-    free(pool);
+    scc_free(pool);
 }
 
 void* memory_pool_alloc(memory_pool_t* pool, size_t size) {
-    if (!pool || size == 0) {
+    if (!pool || size == 0 || size > pool->block_size) {
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
         return NULL;
     }
     
-    // 정렬된 크기 계산
-    size_t aligned_size = (size + pool->alignment - 1) & ~(pool->alignment - 1);
-    
-    // 사용 가능한 블록 찾기
-    memory_block_t* block = pool->blocks;
-    while (block) {
-        if (block->is_free && block->size >= aligned_size) {
-            block->is_free = false;
-            pool->total_used += block->size;
-            return block->data;
-        }
-        block = block->next;
+    // 해제된 객체 재사용
+    void* ptr = pool->free_list;
+    if (ptr) {
+        pool->free_list = *(void**)ptr;
+        pool->total_used += pool->block_size;
+        return ptr;
     }
     
-    // 새 블록 할당
-    size_t alloc_size = (aligned_size > pool->block_size) ? aligned_size : pool->block_size;
-    
-    memory_block_t* new_block = malloc(sizeof(memory_block_t));
-    if (!new_block) {
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
-        return NULL;
-    }
-    
-    new_block->data = aligned_alloc(pool->alignment, alloc_size);
-    if (!new_block->data) {
-        free(new_block);
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+    // 현재 청크가 다 찼으면 새 청크
+    if (pool->bump == pool->bump_end && !pool_add_chunk(pool)) {
         return NULL;
     }
     
-    new_block->size = alloc_size;
-    new_block->is_free = false;
-    new_block->next = pool->blocks;
-    pool->blocks = new_block;
+    ptr = pool->bump;
+    pool->bump += pool->block_size;
+    pool->total_used += pool->block_size;
     
-    pool->total_allocated += alloc_size;
-    pool->total_used += alloc_size;
-    
-    return new_block->data;
+    return ptr;
 }
 
+// ptr은 이 풀에서 할당된 객체여야 함
 void memory_pool_free(memory_pool_t* pool, void* ptr) {
     if (!pool || !ptr) return;
     
-    memory_block_t* block = pool->blocks;
-    while (block) {
-        if (block->data == ptr) {
-            if (!block->is_free) {
-                block->is_free = true;
-                pool->total_used -= block->size;
-            }
-            return;
-        }
-        block = block->next;
-    }
+    *(void**)ptr = pool->free_list;
+    pool->free_list = ptr;
+    pool->total_used -= pool->block_size;
 }
 
+// 모든 객체를 반납: 가장 최근에 추가된 청크만 남기고 나머지는 해제
 void memory_pool_reset(memory_pool_t* pool) {
     if (!pool) return;
     
-    memory_block_t* block = pool->blocks;
-    while (block) {
-        block->is_free = true;
-        block = block->next;
+    memory_chunk_t* keep = pool->chunks;
+    if (keep) {
+        memory_chunk_t* chunk = keep->next;
+        while (chunk) {
+            memory_chunk_t* next = chunk->next;
+            scc_free(chunk);
+            chunk = next;
+        }
+        keep->next = NULL;
+        pool->bump = chunk_data(pool, keep);
+        pool->bump_end = pool->bump + keep->capacity * pool->block_size;
+        pool->total_allocated = keep->capacity * pool->block_size;
     }
     
+    pool->free_list = NULL;
     pool->total_used = 0;
 }
\ No newline at end of file
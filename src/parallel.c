@@ -0,0 +1,699 @@
+#include "scc_parallel.h"
+#include "scc_algorithms.h"
+#include "graph.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// 원자 연산 (OpenMP 2.0에는 compare-and-swap이 없으므로 컴파일러 내장 함수 사용)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SCC_CAS_INT(ptr, expected, desired) \
+    (_InterlockedCompareExchange((volatile long*)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+#define SCC_FETCH_ADD_INT(ptr, value) \
+    ((int)_InterlockedExchangeAdd((volatile long*)(ptr), (long)(value)))
+#else
+#define SCC_CAS_INT(ptr, expected, desired) __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#define SCC_FETCH_ADD_INT(ptr, value) __sync_fetch_and_add((ptr), (value))
+#endif
+
+#define PARALLEL_DEFAULT_CHUNK 1024
+#define PARALLEL_SEQUENTIAL_CUTOFF 4096   // 이 크기 이하의 분할은 순차 Tarjan으로 처리
+#define PARALLEL_MAX_TRIM_ROUNDS 4
+#define PARALLEL_LOCAL_QUEUE 256          // 스레드별 프런티어 버퍼 크기
+
+// 정점 색상: 같은 색상의 미처리 정점들이 하나의 분할을 이룸
+#define COLOR_DONE  -1
+#define COLOR_LIVE   0
+#define COLOR_FWD    1
+#define COLOR_SCC    2
+#define COLOR_BWD    3
+
+typedef struct parallel_ctx {
+    const csr_graph_t* forward;
+    const csr_graph_t* backward;
+
+    int* color;        // 분할 번호 (처리 완료 시 COLOR_DONE)
+    int* component;    // SCC 대표 정점 (트리밍 정점/피벗/Tarjan 루트)
+    int* index;        // 순차 Tarjan용
+    int* lowlink;
+    int* partition;    // 분할별 정점 목록 (분할마다 연속 구간)
+
+    // 단계 1의 병렬 BFS 상태
+    int* frontier;
+    int* next;
+    int frontier_size;
+    int next_size;
+    int trimmed[PARALLEL_MAX_TRIM_ROUNDS];
+    int pivot;
+    int64_t pivot_score;
+
+    int next_color;
+    int status;        // 태스크에서 발생한 첫 오류
+} parallel_ctx_t;
+
+// 내부 헬퍼 함수들
+static int parallel_ctx_init(parallel_ctx_t* ctx, const csr_graph_t* csr);
+static void parallel_ctx_cleanup(parallel_ctx_t* ctx);
+static int parallel_run(parallel_ctx_t* ctx, const scc_parallel_config_t* cfg);
+static void parallel_trim(parallel_ctx_t* ctx);
+static void parallel_select_pivot(parallel_ctx_t* ctx);
+static void parallel_bfs(parallel_ctx_t* ctx, const csr_graph_t* graph,
+                         int from_a, int to_a, int from_b, int to_b);
+static void parallel_process_partition(parallel_ctx_t* ctx, int* verts, int n, int color);
+static int partition_trim(parallel_ctx_t* ctx, int* verts, int n, int color, int* queue);
+static int partition_tarjan(parallel_ctx_t* ctx, const int* verts, int n, int color);
+static scc_result_t* parallel_build_result(parallel_ctx_t* ctx);
+
+scc_parallel_config_t scc_parallel_config_default(void) {
+    scc_parallel_config_t config;
+    config.num_threads = 0;
+    config.chunk_size = PARALLEL_DEFAULT_CHUNK;
+    config.use_work_stealing = true;
+    return config;
+}
+
+// 공개 API 함수
+scc_result_t* scc_find_parallel(const graph_t* graph, const scc_parallel_config_t* config) {
+    if (!graph) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    if (graph_get_vertex_count(graph) <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+
+    csr_graph_t* csr = graph_freeze(graph);
+    if (!csr) {
+        return NULL;
+    }
+
+    scc_result_t* result = scc_find_parallel_csr(csr, config);
+    csr_graph_destroy(csr);
+
+    return result;
+}
+
+scc_result_t* scc_find_parallel_csr(const csr_graph_t* csr, const scc_parallel_config_t* config) {
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+
+    if (csr->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+
+    scc_parallel_config_t cfg = config ? *config : scc_parallel_config_default();
+    if (cfg.num_threads < 0 || cfg.chunk_size < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+    if (cfg.chunk_size == 0) cfg.chunk_size = PARALLEL_DEFAULT_CHUNK;
+
+    parallel_ctx_t ctx;
+    if (parallel_ctx_init(&ctx, csr) != SCC_SUCCESS) {
+        return NULL;
+    }
+
+    scc_result_t* result = NULL;
+    if (parallel_run(&ctx, &cfg) == SCC_SUCCESS) {
+        result = parallel_build_result(&ctx);
+    } else {
+        scc_set_error((scc_error_t)ctx.status);
+    }
+
+    parallel_ctx_cleanup(&ctx);
+    return result;
+}
+
+// 내부 헬퍼 함수들 구현
+
+static int parallel_ctx_init(parallel_ctx_t* ctx, const csr_graph_t* csr) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->forward = csr;
+    ctx->backward = csr_graph_transpose(csr);
+    if (!ctx->backward) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    size_t n = (size_t)csr->num_vertices;
+    ctx->color = scc_calloc(n, sizeof(int));   // 모든 정점은 COLOR_LIVE에서 시작
+    ctx->component = scc_malloc(n * sizeof(int));
+    ctx->index = scc_malloc(n * sizeof(int));
+    ctx->lowlink = scc_malloc(n * sizeof(int));
+    ctx->partition = scc_malloc(n * sizeof(int));
+    ctx->frontier = scc_malloc(n * sizeof(int));
+    ctx->next = scc_malloc(n * sizeof(int));
+    if (!ctx->color || !ctx->component || !ctx->index || !ctx->lowlink ||
+        !ctx->partition || !ctx->frontier || !ctx->next) {
+        parallel_ctx_cleanup(ctx);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    ctx->pivot = -1;
+    ctx->pivot_score = -1;
+    ctx->next_color = COLOR_BWD + 1;
+    ctx->status = SCC_SUCCESS;
+
+    return SCC_SUCCESS;
+}
+
+static void parallel_ctx_cleanup(parallel_ctx_t* ctx) {
+    scc_free(ctx->next);
+    scc_free(ctx->frontier);
+    scc_free(ctx->partition);
+    scc_free(ctx->lowlink);
+    scc_free(ctx->index);
+    scc_free(ctx->component);
+    scc_free(ctx->color);
+    csr_graph_destroy((csr_graph_t*)ctx->backward);
+}
+
+static int parallel_run(parallel_ctx_t* ctx, const scc_parallel_config_t* cfg) {
+    int num_vertices = ctx->forward->num_vertices;
+    int num_threads = cfg->num_threads;
+#ifdef _OPENMP
+    if (num_threads == 0) num_threads = omp_get_max_threads();
+
+    // 정점 루프는 schedule(runtime)을 사용하므로 호출자의 스케줄을 잠시 교체
+    omp_sched_t saved_kind;
+    int saved_chunk;
+    omp_get_schedule(&saved_kind, &saved_chunk);
+    omp_set_schedule(cfg->use_work_stealing ? omp_sched_dynamic : omp_sched_static,
+                     cfg->chunk_size);
+#else
+    if (num_threads == 0) num_threads = 1;
+#endif
+
+    // 1단계: 트리밍 후 거대 SCC를 병렬 BFS로 분리
+    #pragma omp parallel num_threads(num_threads)
+    {
+        parallel_trim(ctx);
+        parallel_select_pivot(ctx);
+
+        if (ctx->pivot >= 0) {
+            #pragma omp single
+            {
+                ctx->color[ctx->pivot] = COLOR_FWD;
+                ctx->frontier[0] = ctx->pivot;
+                ctx->frontier_size = 1;
+            }
+            parallel_bfs(ctx, ctx->forward, COLOR_LIVE, COLOR_FWD, COLOR_DONE, COLOR_DONE);
+
+            #pragma omp single
+            {
+                ctx->color[ctx->pivot] = COLOR_SCC;
+                ctx->frontier[0] = ctx->pivot;
+                ctx->frontier_size = 1;
+            }
+            parallel_bfs(ctx, ctx->backward, COLOR_FWD, COLOR_SCC, COLOR_LIVE, COLOR_BWD);
+
+            int v;
+            #pragma omp for schedule(runtime)
+            for (v = 0; v < num_vertices; v++) {
+                if (ctx->color[v] == COLOR_SCC) {
+                    ctx->color[v] = COLOR_DONE;
+                    ctx->component[v] = ctx->pivot;
+                }
+            }
+        }
+    }
+
+    // 남은 정점을 색상별 연속 구간으로 모음 (LIVE, FWD, BWD)
+    int counts[COLOR_BWD + 1] = {0};
+    for (int v = 0; v < num_vertices; v++) {
+        if (ctx->color[v] != COLOR_DONE) counts[ctx->color[v]]++;
+    }
+    int starts[COLOR_BWD + 1];
+    starts[COLOR_LIVE] = 0;
+    starts[COLOR_FWD] = counts[COLOR_LIVE];
+    starts[COLOR_SCC] = starts[COLOR_FWD] + counts[COLOR_FWD];
+    starts[COLOR_BWD] = starts[COLOR_SCC];
+    int fill[COLOR_BWD + 1];
+    memcpy(fill, starts, sizeof(fill));
+    for (int v = 0; v < num_vertices; v++) {
+        if (ctx->color[v] != COLOR_DONE) ctx->partition[fill[ctx->color[v]]++] = v;
+    }
+
+    // 2단계: 각 분할을 독립 태스크로 재귀 FW-BW 처리
+    #pragma omp parallel num_threads(num_threads)
+    {
+        #pragma omp single
+        {
+            static const int colors[] = { COLOR_LIVE, COLOR_FWD, COLOR_BWD };
+            for (int i = 0; i < 3; i++) {
+                int c = colors[i];
+                if (counts[c] > 0) {
+                    int* verts = ctx->partition + starts[c];
+                    int n = counts[c];
+                    #pragma omp task firstprivate(verts, n, c)
+                    parallel_process_partition(ctx, verts, n, c);
+                }
+            }
+        }
+    }
+
+#ifdef _OPENMP
+    omp_set_schedule(saved_kind, saved_chunk);
+#endif
+
+    return ctx->status;
+}
+
+// 같은 분할 안에 자기 자신이 아닌 이웃이 있는지 확인
+static bool has_live_neighbor(const csr_graph_t* graph, const int* color, int v) {
+    for (int64_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) {
+        int w = graph->targets[e];
+        if (w != v && color[w] == color[v]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 진입 또는 진출 이웃이 없는 정점은 단독 SCC
+// 라운드마다 판정과 적용을 배리어로 분리하여 판정이 이전 라운드 결과만 보도록 함
+static void parallel_trim(parallel_ctx_t* ctx) {
+    int num_vertices = ctx->forward->num_vertices;
+    int* flag = ctx->next;   // 단계 1의 BFS 전까지는 임시 배열로 사용
+
+    for (int round = 0; round < PARALLEL_MAX_TRIM_ROUNDS; round++) {
+        int v;
+        #pragma omp for schedule(runtime)
+        for (v = 0; v < num_vertices; v++) {
+            flag[v] = ctx->color[v] != COLOR_DONE &&
+                      (!has_live_neighbor(ctx->forward, ctx->color, v) ||
+                       !has_live_neighbor(ctx->backward, ctx->color, v));
+        }
+
+        int local_trimmed = 0;
+        #pragma omp for schedule(runtime) nowait
+        for (v = 0; v < num_vertices; v++) {
+            if (flag[v]) {
+                ctx->color[v] = COLOR_DONE;
+                ctx->component[v] = v;
+                local_trimmed++;
+            }
+        }
+
+        #pragma omp atomic
+        ctx->trimmed[round] += local_trimmed;
+
+        #pragma omp barrier
+        if (ctx->trimmed[round] == 0) break;
+    }
+}
+
+// 진입/진출 차수의 곱이 가장 큰 정점을 피벗으로 선택 (거대 SCC에 속할 확률이 높음)
+// 동점이면 번호가 작은 정점을 택하므로 스레드 수와 무관하게 결정적임
+static void parallel_select_pivot(parallel_ctx_t* ctx) {
+    int num_vertices = ctx->forward->num_vertices;
+    int best = -1;
+    int64_t best_score = -1;
+    int v;
+
+    #pragma omp for schedule(runtime) nowait
+    for (v = 0; v < num_vertices; v++) {
+        if (ctx->color[v] != COLOR_LIVE) continue;
+        int64_t out_degree = ctx->forward->offsets[v + 1] - ctx->forward->offsets[v];
+        int64_t in_degree = ctx->backward->offsets[v + 1] - ctx->backward->offsets[v];
+        int64_t score = (out_degree + 1) * (in_degree + 1);
+        if (score > best_score || (score == best_score && v < best)) {
+            best_score = score;
+            best = v;
+        }
+    }
+
+    #pragma omp critical
+    {
+        if (best >= 0 && (best_score > ctx->pivot_score ||
+                          (best_score == ctx->pivot_score && best < ctx->pivot))) {
+            ctx->pivot_score = best_score;
+            ctx->pivot = best;
+        }
+    }
+
+    #pragma omp barrier
+}
+
+// BFS에서 정점 w를 차지: 색상이 from_a/from_b이면 to_a/to_b로 CAS 전환
+static bool bfs_claim(int* color, int w, int from_a, int to_a, int from_b, int to_b) {
+    int c = color[w];
+    return (c == from_a && SCC_CAS_INT(&color[w], from_a, to_a)) ||
+           (c == from_b && from_b != COLOR_DONE && SCC_CAS_INT(&color[w], from_b, to_b));
+}
+
+// 레벨 동기 병렬 BFS (시작 프런티어는 호출자가 설정)
+// 프런티어가 작은 구간은 스레드 하나가 연속으로 처리하여 경로처럼 깊고 좁은 그래프에서
+// 레벨마다 배리어 비용을 치르지 않도록 함
+static void parallel_bfs(parallel_ctx_t* ctx, const csr_graph_t* graph,
+                         int from_a, int to_a, int from_b, int to_b) {
+    int* color = ctx->color;
+
+    while (ctx->frontier_size > 0) {
+        if (ctx->frontier_size < PARALLEL_LOCAL_QUEUE) {
+            // 모든 스레드가 크기를 읽은 뒤에 변경해야 분기가 어긋나지 않음
+            #pragma omp barrier
+            #pragma omp single
+            {
+                while (ctx->frontier_size > 0 && ctx->frontier_size < PARALLEL_LOCAL_QUEUE) {
+                    int next_size = 0;
+                    for (int i = 0; i < ctx->frontier_size; i++) {
+                        int v = ctx->frontier[i];
+                        for (int64_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) {
+                            int w = graph->targets[e];
+                            if (bfs_claim(color, w, from_a, to_a, from_b, to_b)) {
+                                ctx->next[next_size++] = w;
+                            }
+                        }
+                    }
+                    int* swap = ctx->frontier;
+                    ctx->frontier = ctx->next;
+                    ctx->next = swap;
+                    ctx->frontier_size = next_size;
+                }
+            }
+            continue;
+        }
+
+        int local[PARALLEL_LOCAL_QUEUE];
+        int local_size = 0;
+        int i;
+
+        #pragma omp for schedule(runtime) nowait
+        for (i = 0; i < ctx->frontier_size; i++) {
+            int v = ctx->frontier[i];
+            for (int64_t e = graph->offsets[v]; e < graph->offsets[v + 1]; e++) {
+                int w = graph->targets[e];
+                if (!bfs_claim(color, w, from_a, to_a, from_b, to_b)) continue;
+
+                if (local_size == PARALLEL_LOCAL_QUEUE) {
+                    int pos = SCC_FETCH_ADD_INT(&ctx->next_size, local_size);
+                    memcpy(ctx->next + pos, local, local_size * sizeof(int));
+                    local_size = 0;
+                }
+                local[local_size++] = w;
+            }
+        }
+
+        if (local_size > 0) {
+            int pos = SCC_FETCH_ADD_INT(&ctx->next_size, local_size);
+            memcpy(ctx->next + pos, local, local_size * sizeof(int));
+        }
+
+        #pragma omp barrier
+        #pragma omp single
+        {
+            int* swap = ctx->frontier;
+            ctx->frontier = ctx->next;
+            ctx->next = swap;
+            ctx->frontier_size = ctx->next_size;
+            ctx->next_size = 0;
+        }
+    }
+
+    // 모든 스레드가 종료 조건을 읽은 뒤에야 호출자가 프런티어를 다시 설정할 수 있음
+    #pragma omp barrier
+}
+
+// 분할 하나를 처리: 작으면 순차 Tarjan, 크면 FW-BW로 나누어 하위 분할을 태스크로 생성
+// verts는 이 분할만 소유하는 구간이므로 제자리에서 재배치함
+static void parallel_process_partition(parallel_ctx_t* ctx, int* verts, int n, int color) {
+    int* queue = scc_malloc((size_t)n * sizeof(int));
+    if (!queue) {
+        ctx->status = SCC_ERROR_MEMORY_ALLOCATION;
+        return;
+    }
+
+    // DAG 형태의 영역은 트리밍만으로 전부 해소되므로 분할 전에 먼저 적용
+    n = partition_trim(ctx, verts, n, color, queue);
+    if (n <= PARALLEL_SEQUENTIAL_CUTOFF) {
+        scc_free(queue);
+        if (n > 0 && partition_tarjan(ctx, verts, n, color) != SCC_SUCCESS) {
+            ctx->status = SCC_ERROR_MEMORY_ALLOCATION;
+        }
+        return;
+    }
+
+    int* colors = ctx->color;
+    int pivot = verts[n / 2];
+    int base = SCC_FETCH_ADD_INT(&ctx->next_color, 3);
+    int fwd = base, scc = base + 1, bwd = base + 2;
+
+    // 전방 도달 집합
+    int head = 0, tail = 0;
+    colors[pivot] = fwd;
+    queue[tail++] = pivot;
+    while (head < tail) {
+        int v = queue[head++];
+        for (int64_t e = ctx->forward->offsets[v]; e < ctx->forward->offsets[v + 1]; e++) {
+            int w = ctx->forward->targets[e];
+            if (colors[w] == color) {
+                colors[w] = fwd;
+                queue[tail++] = w;
+            }
+        }
+    }
+
+    // 후방 도달 집합: 전방 집합과의 교집합이 피벗의 SCC
+    head = tail = 0;
+    colors[pivot] = scc;
+    queue[tail++] = pivot;
+    while (head < tail) {
+        int v = queue[head++];
+        for (int64_t e = ctx->backward->offsets[v]; e < ctx->backward->offsets[v + 1]; e++) {
+            int w = ctx->backward->targets[e];
+            if (colors[w] == fwd) {
+                colors[w] = scc;
+                queue[tail++] = w;
+            } else if (colors[w] == color) {
+                colors[w] = bwd;
+                queue[tail++] = w;
+            }
+        }
+    }
+    scc_free(queue);
+
+    // 제자리 재배치: [나머지 | 전방 전용 | 후방 전용], SCC 정점은 제거
+    int rest_end = 0, fwd_end, bwd_end;
+    for (int i = 0; i < n; i++) {
+        int v = verts[i];
+        if (colors[v] == scc) {
+            colors[v] = COLOR_DONE;
+            ctx->component[v] = pivot;
+        } else if (colors[v] == color) {
+            verts[i] = verts[rest_end];
+            verts[rest_end++] = v;
+        }
+    }
+    fwd_end = rest_end;
+    for (int i = rest_end; i < n; i++) {
+        int v = verts[i];
+        if (colors[v] == fwd) {
+            verts[i] = verts[fwd_end];
+            verts[fwd_end++] = v;
+        }
+    }
+    bwd_end = fwd_end;
+    for (int i = fwd_end; i < n; i++) {
+        int v = verts[i];
+        if (colors[v] == bwd) {
+            verts[i] = verts[bwd_end];
+            verts[bwd_end++] = v;
+        }
+    }
+
+    // 세 하위 분할 사이에는 SCC가 걸칠 수 없으므로 독립적으로 처리 가능
+    if (rest_end > 0) {
+        #pragma omp task firstprivate(verts, rest_end, color)
+        parallel_process_partition(ctx, verts, rest_end, color);
+    }
+    if (fwd_end > rest_end) {
+        #pragma omp task firstprivate(verts, rest_end, fwd_end, fwd)
+        parallel_process_partition(ctx, verts + rest_end, fwd_end - rest_end, fwd);
+    }
+    if (bwd_end > fwd_end) {
+        #pragma omp task firstprivate(verts, fwd_end, bwd_end, bwd)
+        parallel_process_partition(ctx, verts + fwd_end, bwd_end - fwd_end, bwd);
+    }
+}
+
+// 분할 내부의 진입/진출 차수로 고정점까지 트리밍 (작업 목록 방식, O(n + e))
+// 남은 정점을 verts 앞쪽으로 모으고 그 개수를 반환
+static int partition_trim(parallel_ctx_t* ctx, int* verts, int n, int color, int* queue) {
+    const csr_graph_t* forward = ctx->forward;
+    const csr_graph_t* backward = ctx->backward;
+    int* colors = ctx->color;
+    int* in_degree = ctx->index;     // Tarjan 전까지 차수 카운터로 사용
+    int* out_degree = ctx->lowlink;
+    int tail = 0;
+
+    for (int i = 0; i < n; i++) {
+        int v = verts[i];
+        int out = 0, in = 0;
+        for (int64_t e = forward->offsets[v]; e < forward->offsets[v + 1]; e++) {
+            int w = forward->targets[e];
+            if (w != v && colors[w] == color) out++;
+        }
+        for (int64_t e = backward->offsets[v]; e < backward->offsets[v + 1]; e++) {
+            int w = backward->targets[e];
+            if (w != v && colors[w] == color) in++;
+        }
+        out_degree[v] = out;
+        in_degree[v] = in;
+        if (out == 0 || in == 0) queue[tail++] = v;
+    }
+
+    // 정점 제거로 이웃의 차수가 0이 되면 목록에 추가 (다른 차수가 이미 0이면 추가된 상태)
+    for (int head = 0; head < tail; head++) {
+        int v = queue[head];
+        colors[v] = COLOR_DONE;
+        ctx->component[v] = v;
+        for (int64_t e = forward->offsets[v]; e < forward->offsets[v + 1]; e++) {
+            int w = forward->targets[e];
+            if (w != v && colors[w] == color && --in_degree[w] == 0 && out_degree[w] != 0) {
+                queue[tail++] = w;
+            }
+        }
+        for (int64_t e = backward->offsets[v]; e < backward->offsets[v + 1]; e++) {
+            int w = backward->targets[e];
+            if (w != v && colors[w] == color && --out_degree[w] == 0 && in_degree[w] != 0) {
+                queue[tail++] = w;
+            }
+        }
+    }
+
+    int remaining = 0;
+    for (int i = 0; i < n; i++) {
+        if (colors[verts[i]] == color) verts[remaining++] = verts[i];
+    }
+    return remaining;
+}
+
+// 분할 내부로 제한한 반복형 Tarjan
+// 분할 밖(다른 색상 또는 처리 완료) 정점으로 가는 간선은 무시함
+// 방문했지만 처리되지 않은 정점은 모두 Tarjan 스택 위에 있으므로 on_stack 배열이 필요 없음
+static int partition_tarjan(parallel_ctx_t* ctx, const int* verts, int n, int color) {
+    const int64_t* offsets = ctx->forward->offsets;
+    const int* targets = ctx->forward->targets;
+    int* colors = ctx->color;
+    int* index = ctx->index;
+    int* lowlink = ctx->lowlink;
+
+    int* stack = scc_malloc((size_t)n * sizeof(int));
+    dfs_frame_t* frames = scc_malloc((size_t)n * sizeof(dfs_frame_t));
+    if (!stack || !frames) {
+        scc_free(frames);
+        scc_free(stack);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+
+    for (int i = 0; i < n; i++) {
+        index[verts[i]] = -1;
+    }
+
+    int next_index = 0, stack_top = 0;
+    for (int i = 0; i < n; i++) {
+        int root = verts[i];
+        if (colors[root] != color || index[root] != -1) continue;
+
+        int depth = 0;
+        index[root] = lowlink[root] = next_index++;
+        stack[stack_top++] = root;
+        frames[depth].vertex = root;
+        frames[depth].next_edge = offsets[root];
+        depth++;
+
+        while (depth > 0) {
+            dfs_frame_t* frame = &frames[depth - 1];
+            int v = frame->vertex;
+
+            if (frame->next_edge < offsets[v + 1]) {
+                int w = targets[frame->next_edge++];
+                if (colors[w] != color) continue;
+
+                if (index[w] == -1) {
+                    index[w] = lowlink[w] = next_index++;
+                    stack[stack_top++] = w;
+                    frames[depth].vertex = w;
+                    frames[depth].next_edge = offsets[w];
+                    depth++;
+                } else if (index[w] < lowlink[v]) {
+                    lowlink[v] = index[w];
+                }
+                continue;
+            }
+
+            if (lowlink[v] == index[v]) {
+                int w;
+                do {
+                    w = stack[--stack_top];
+                    colors[w] = COLOR_DONE;
+                    ctx->component[w] = v;
+                } while (w != v);
+            }
+
+            depth--;
+            if (depth > 0) {
+                int parent = frames[depth - 1].vertex;
+                if (lowlink[v] < lowlink[parent]) lowlink[parent] = lowlink[v];
+            }
+        }
+    }
+
+    scc_free(frames);
+    scc_free(stack);
+    return SCC_SUCCESS;
+}
+
+// 대표 정점으로 표시된 컴포넌트를 표준 순서의 평탄 결과로 변환
+// 컴포넌트는 가장 작은 정점 순, 컴포넌트 내부 정점은 오름차순
+static scc_result_t* parallel_build_result(parallel_ctx_t* ctx) {
+    int num_vertices = ctx->forward->num_vertices;
+    scc_result_t* result = scc_result_create(num_vertices);
+    if (!result) {
+        return NULL;
+    }
+
+    int* label = ctx->index;   // 대표 정점 -> 컴포넌트 번호
+    for (int v = 0; v < num_vertices; v++) {
+        label[v] = -1;
+    }
+
+    int num_components = 0;
+    int* offsets = result->component_offsets;
+    for (int v = 0; v < num_vertices; v++) {
+        int rep = ctx->component[v];
+        if (label[rep] == -1) {
+            label[rep] = num_components++;
+            offsets[num_components] = 0;
+        }
+        int c = label[rep];
+        result->vertex_to_component[v] = c;
+        offsets[c + 1]++;
+    }
+
+    for (int c = 0; c < num_components; c++) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    // 오름차순 정점 순회로 각 컴포넌트 구간을 채움
+    int* cursor = ctx->lowlink;
+    memcpy(cursor, offsets, (size_t)num_components * sizeof(int));
+    for (int v = 0; v < num_vertices; v++) {
+        result->vertices[cursor[result->vertex_to_component[v]]++] = v;
+    }
+
+    result->num_components = num_components;
+    scc_result_compute_statistics(result);
+
+    return result;
+}
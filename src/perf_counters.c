@@ -0,0 +1,153 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  // syscall()
+#endif
+
+#include "scc.h"
+#include "scc_algorithms.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 하드웨어 성능 카운터 (Linux perf_event_open)
+// 카운터마다 따로 열어서 일부가 지원되지 않거나 권한이 없어도 나머지는 사용함
+// (perf_event_paranoid, 가상 머신, 컨테이너 seccomp 등)
+struct scc_perf_counters {
+    int fds[SCC_HW_COUNTER_COUNT];  // -1이면 사용할 수 없는 카운터
+};
+
+static const char* const hw_counter_names[SCC_HW_COUNTER_COUNT] = {
+    "cycles",
+    "instructions",
+    "llc_misses",
+    "dtlb_misses",
+    "branch_misses"
+};
+
+const char* scc_hw_counter_name(scc_hw_counter_t counter) {
+    if ((int)counter < 0 || counter >= SCC_HW_COUNTER_COUNT) return "unknown";
+    return hw_counter_names[counter];
+}
+
+#ifdef __linux__
+
+#define PERF_CACHE_READ_MISS(cache) \
+    ((cache) | ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8) | \
+     ((uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} perf_events[SCC_HW_COUNTER_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_LL) },
+    { PERF_TYPE_HW_CACHE, PERF_CACHE_READ_MISS(PERF_COUNT_HW_CACHE_DTLB) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+};
+
+// 호출 스레드(와 이후 생성되는 스레드)의 사용자 모드만 측정
+static int perf_open_event(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+    return fd < 0 ? -1 : (int)fd;
+}
+
+#endif
+
+scc_perf_counters_t* scc_perf_counters_open(void) {
+#ifdef __linux__
+    scc_perf_counters_t* counters = scc_malloc(sizeof(scc_perf_counters_t));
+    if (!counters) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    int opened = 0;
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        counters->fds[i] = perf_open_event(perf_events[i].type, perf_events[i].config);
+        if (counters->fds[i] >= 0) opened++;
+    }
+
+    // 하나도 열리지 않으면 측정 없이 진행하도록 NULL 반환 (오류 아님)
+    if (opened == 0) {
+        scc_free(counters);
+        return NULL;
+    }
+    return counters;
+#else
+    return NULL;
+#endif
+}
+
+void scc_perf_counters_close(scc_perf_counters_t* counters) {
+    if (!counters) return;
+
+#ifdef __linux__
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        if (counters->fds[i] >= 0) close(counters->fds[i]);
+    }
+#endif
+    scc_free(counters);
+}
+
+void scc_perf_counters_start(scc_perf_counters_t* counters) {
+    if (!counters) return;
+
+#ifdef __linux__
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        if (counters->fds[i] < 0) continue;
+        ioctl(counters->fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(counters->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+// 카운터를 멈추고 sample에 더함
+// 다중화로 일부 시간만 측정됐으면 enabled/running 비율로 보정
+void scc_perf_counters_stop(scc_perf_counters_t* counters, scc_hw_counters_t* sample) {
+    if (!counters) return;
+
+#ifdef __linux__
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        if (counters->fds[i] >= 0) {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        uint64_t data[3];  // value, time_enabled, time_running
+        if (counters->fds[i] < 0 ||
+            read(counters->fds[i], data, sizeof(data)) != (ssize_t)sizeof(data) ||
+            data[2] == 0) {
+            continue;
+        }
+
+        uint64_t value = data[0];
+        if (data[2] < data[1]) {
+            value = (uint64_t)((double)value * (double)data[1] / (double)data[2]);
+        }
+        if (sample) {
+            sample->values[i] += value;
+            sample->valid[i] = true;
+        }
+    }
+#else
+    (void)sample;
+#endif
+}
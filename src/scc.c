@@ -1,23 +1,81 @@
 #include "scc.h"
 #include "scc_algorithms.h"
+#include "graph.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
+#include <stdint.h>
 
 // SCC 결과 관리
-void scc_result_destroy(scc_result_t* result) {
+// 모든 컴포넌트가 하나의 정점 순열 배열과 오프셋 배열을 공유하므로
+// 컴포넌트 수와 무관하게 할당은 세 번뿐임
+scc_result_t* scc_result_create(int num_vertices) {
+    if (num_vertices < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+    
+    scc_result_t* result = scc_malloc(sizeof(scc_result_t));
+    if (!result) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+    
+    size_t count = (num_vertices > 0) ? (size_t)num_vertices : 1;
+    result->vertices = scc_malloc(count * sizeof(int));
+    result->component_offsets = scc_malloc((count + 1) * sizeof(int));
+    result->vertex_to_component = scc_malloc(count * sizeof(int));
+    if (!result->vertices || !result->component_offsets || !result->vertex_to_component) {
+        scc_free(result->vertex_to_component);
+        scc_free(result->component_offsets);
+        scc_free(result->vertices);
+        scc_free(result);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+    
+    result->component_offsets[0] = 0;
+    result->num_components = 0;
+    result->num_vertices = num_vertices;
+    result->mapping = NULL;
+    result->mapping_size = 0;
+    result->largest_component_size = 0;
+    result->smallest_component_size = 0;
+    result->average_component_size = 0.0;
+    
+    return result;
+}
+
+void scc_result_compute_statistics(scc_result_t* result) {
     if (!result) return;
     
-    if (result->components) {
-        for (int i = 0; i < result->num_components; i++) {
-            free(result->components[i].vertices);
-        }
-        free(result->components);
+    int largest = 0, smallest = result->num_vertices + 1;
+    
+    for (int i = 0; i < result->num_components; i++) {
+        int size = result->component_offsets[i + 1] - result->component_offsets[i];
+        if (size > largest) largest = size;
+        if (size < smallest) smallest = size;
     }
     
-    free(result->vertex_to_component);
-    free(result);
+    result->largest_component_size = largest;
+    result->smallest_component_size = (result->num_components > 0) ? smallest : 0;
+    result->average_component_size = (result->num_components > 0) ? 
+        (double)result->component_offsets[result->num_components] / result->num_components : 0.0;
+}
+
+void scc_result_destroy(scc_result_t* result) {
+    if (!result) return;
+    
+    if (result->mapping) {
+        scc_unmap_file(result->mapping, result->mapping_size);
+    } else {
+        scc_free(result->vertex_to_component);
+        scc_free(result->component_offsets);
+        scc_free(result->vertices);
+    }
+    scc_free(result);
 }
 
 scc_result_t* scc_result_copy(const scc_result_t* result) {
@@ -26,9 +84,8 @@ scc_result_t* scc_result_copy(const scc_result_t* result) {
         return NULL;
     }
     
-    scc_result_t* copy = malloc(sizeof(scc_result_t));
+    scc_result_t* copy = scc_result_create(result->num_vertices);
     if (!copy) {
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
@@ -37,54 +94,233 @@ scc_result_t* scc_result_copy(const scc_result_t* result) {
     copy->smallest_component_size = result->smallest_component_size;
     copy->average_component_size = result->average_component_size;
     
-    // vertex_to_component 배열 복사
-    int total_vertices = 0;
-    for (int i = 0; i < result->num_components; i++) {
-        total_vertices += result->components[i].size;
+    memcpy(copy->vertices, result->vertices, result->num_vertices * sizeof(int));
+    memcpy(copy->component_offsets, result->component_offsets,
+           (result->num_components + 1) * sizeof(int));
+    memcpy(copy->vertex_to_component, result->vertex_to_component,
+           result->num_vertices * sizeof(int));
+
+    return copy;
+}
+
+// 양쪽 컴포넌트 번호를 정점 순서상 처음 등장한 순서로 다시 매겨 비교
+// 같은 분할이면 모든 정점에서 새 번호가 일치함
+bool scc_result_equivalent(const scc_result_t* a, const scc_result_t* b) {
+    if (!a || !b) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return false;
     }
-    
-    copy->vertex_to_component = malloc(total_vertices * sizeof(int));
-    if (!copy->vertex_to_component) {
-        free(copy);
+    if (a->num_vertices != b->num_vertices || a->num_components != b->num_components) {
+        return false;
+    }
+
+    int num_components = a->num_components;
+    size_t count = (num_components > 0) ? (size_t)num_components : 1;
+    int* label_a = scc_malloc(count * sizeof(int));
+    int* label_b = scc_malloc(count * sizeof(int));
+    if (!label_a || !label_b) {
+        scc_free(label_a);
+        scc_free(label_b);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return false;
+    }
+    for (int c = 0; c < num_components; c++) {
+        label_a[c] = -1;
+        label_b[c] = -1;
+    }
+
+    bool equivalent = true;
+    int next_a = 0, next_b = 0;
+    for (int v = 0; v < a->num_vertices && equivalent; v++) {
+        int ca = a->vertex_to_component[v];
+        int cb = b->vertex_to_component[v];
+        if (ca < 0 || ca >= num_components || cb < 0 || cb >= num_components) {
+            equivalent = false;
+            break;
+        }
+        if (label_a[ca] == -1) label_a[ca] = next_a++;
+        if (label_b[cb] == -1) label_b[cb] = next_b++;
+        equivalent = (label_a[ca] == label_b[cb]);
+    }
+
+    scc_free(label_a);
+    scc_free(label_b);
+    return equivalent;
+}
+
+// 바이너리 결과 파일
+// [헤더 | vertex_to_component (V) | component_offsets (C + 1) | vertices (V)]
+// 각 구획은 SCC_RESULT_ALIGNMENT 경계에서 시작하므로 매핑한 그대로 사용 가능
+#define SCC_RESULT_MAGIC "SCCRESLT"
+#define SCC_RESULT_VERSION 1
+#define SCC_RESULT_BYTE_ORDER 0x01020304u
+#define SCC_RESULT_ALIGNMENT 4096
+
+typedef struct scc_result_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;        // 쓴 시스템의 바이트 순서 확인용
+    uint32_t header_size;
+    uint32_t alignment;
+    int64_t num_vertices;
+    int64_t num_components;
+    int64_t largest_component_size;
+    int64_t smallest_component_size;
+    double average_component_size;
+    uint64_t vertex_to_component_pos;
+    uint64_t offsets_pos;
+    uint64_t vertices_pos;
+    uint64_t file_size;
+} scc_result_header_t;
+
+static uint64_t result_align_up(uint64_t value) {
+    return (value + SCC_RESULT_ALIGNMENT - 1) / SCC_RESULT_ALIGNMENT * SCC_RESULT_ALIGNMENT;
+}
+
+// 현재 위치 *pos에서 section_pos까지 0으로 채운 뒤 구획을 기록
+static bool write_result_section(FILE* file, uint64_t* pos, uint64_t section_pos,
+                                 const void* data, size_t bytes) {
+    static const char zeros[SCC_RESULT_ALIGNMENT];
+    size_t padding = (size_t)(section_pos - *pos);
+    if (padding > 0 && fwrite(zeros, 1, padding, file) != padding) return false;
+    if (bytes > 0 && fwrite(data, 1, bytes, file) != bytes) return false;
+    *pos = section_pos + bytes;
+    return true;
+}
+
+int scc_result_save(const scc_result_t* result, const char* filename) {
+    if (!result || !filename) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+
+    size_t vertex_bytes = (size_t)result->num_vertices * sizeof(int);
+    size_t offset_bytes = ((size_t)result->num_components + 1) * sizeof(int);
+
+    scc_result_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SCC_RESULT_MAGIC, sizeof(header.magic));
+    header.version = SCC_RESULT_VERSION;
+    header.byte_order = SCC_RESULT_BYTE_ORDER;
+    header.header_size = sizeof(scc_result_header_t);
+    header.alignment = SCC_RESULT_ALIGNMENT;
+    header.num_vertices = result->num_vertices;
+    header.num_components = result->num_components;
+    header.largest_component_size = result->largest_component_size;
+    header.smallest_component_size = result->smallest_component_size;
+    header.average_component_size = result->average_component_size;
+    header.vertex_to_component_pos = result_align_up(sizeof(scc_result_header_t));
+    header.offsets_pos = result_align_up(header.vertex_to_component_pos + vertex_bytes);
+    header.vertices_pos = result_align_up(header.offsets_pos + offset_bytes);
+    header.file_size = header.vertices_pos + vertex_bytes;
+
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+
+    uint64_t pos = 0;
+    bool ok = write_result_section(file, &pos, 0, &header, sizeof(header)) &&
+              write_result_section(file, &pos, header.vertex_to_component_pos,
+                                   result->vertex_to_component, vertex_bytes) &&
+              write_result_section(file, &pos, header.offsets_pos,
+                                   result->component_offsets, offset_bytes) &&
+              write_result_section(file, &pos, header.vertices_pos,
+                                   result->vertices, vertex_bytes);
+    if (fclose(file) != 0) ok = false;
+
+    if (!ok) {
+        remove(filename);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+    return SCC_SUCCESS;
+}
+
+// [pos, pos + bytes) 구획이 크기 size인 파일 안에 있는지 확인 (오버플로 없이)
+static bool result_section_fits(uint64_t pos, uint64_t bytes, uint64_t size) {
+    return pos <= size && bytes <= size - pos;
+}
+
+// 헤더 검증: 구획이 파일 안에 있고 정렬되어 있으며 크기가 맞는지 확인 (O(1))
+static bool result_header_valid(const scc_result_header_t* header, size_t size) {
+    if (size < sizeof(scc_result_header_t) ||
+        memcmp(header->magic, SCC_RESULT_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != SCC_RESULT_VERSION ||
+        header->byte_order != SCC_RESULT_BYTE_ORDER ||
+        header->header_size != sizeof(scc_result_header_t) ||
+        header->num_vertices < 0 || header->num_vertices > INT_MAX ||
+        header->num_components < 0 || header->num_components > header->num_vertices ||
+        header->file_size != size) {
+        return false;
+    }
+
+    if (header->vertex_to_component_pos % SCC_RESULT_ALIGNMENT != 0 ||
+        header->offsets_pos % SCC_RESULT_ALIGNMENT != 0 ||
+        header->vertices_pos % SCC_RESULT_ALIGNMENT != 0 ||
+        header->vertex_to_component_pos < sizeof(scc_result_header_t)) {
+        return false;
+    }
+
+    // 위치가 손상되어도 덧셈이 넘치지 않도록 각 구획을 남은 크기와 비교
+    uint64_t vertex_bytes = (uint64_t)header->num_vertices * sizeof(int);
+    uint64_t offset_bytes = ((uint64_t)header->num_components + 1) * sizeof(int);
+    return result_section_fits(header->vertex_to_component_pos, vertex_bytes, size) &&
+           result_section_fits(header->offsets_pos, offset_bytes, size) &&
+           result_section_fits(header->vertices_pos, vertex_bytes, size) &&
+           header->offsets_pos >= header->vertex_to_component_pos + vertex_bytes &&
+           header->vertices_pos >= header->offsets_pos + offset_bytes &&
+           header->vertices_pos + vertex_bytes == size;
+}
+
+// 결과 파일을 매핑하여 복사 없이 사용 (배열은 읽기 전용)
+scc_result_t* scc_result_load(const char* filename) {
+    if (!filename) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
         return NULL;
     }
-    memcpy(copy->vertex_to_component, result->vertex_to_component, 
-           total_vertices * sizeof(int));
-    
-    // 컴포넌트들 복사
-    copy->components = malloc(result->num_components * sizeof(scc_component_t));
-    if (!copy->components) {
-        free(copy->vertex_to_component);
-        free(copy);
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+
+    const void* data;
+    size_t size;
+    if (scc_map_file(filename, &data, &size) != SCC_SUCCESS) {
         return NULL;
     }
-    
-    for (int i = 0; i < result->num_components; i++) {
-        scc_component_t* src_comp = &result->components[i];
-        scc_component_t* dst_comp = &copy->components[i];
-        
-        dst_comp->size = src_comp->size;
-        dst_comp->capacity = src_comp->size; // 필요한 크기만 할당
-        
-        dst_comp->vertices = malloc(dst_comp->capacity * sizeof(int));
-        if (!dst_comp->vertices) {
-            // 이전 컴포넌트들 정리
-            for (int j = 0; j < i; j++) {
-                free(copy->components[j].vertices);
-            }
-            free(copy->components);
-            free(copy->vertex_to_component);
-            free(copy);
-            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
-            return NULL;
-        }
-        
-        memcpy(dst_comp->vertices, src_comp->vertices, src_comp->size * sizeof(int));
+
+    const scc_result_header_t* header = data;
+    if (!data || !result_header_valid(header, size)) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
     }
-    
-    return copy;
+
+    const char* base = data;
+    const int* offsets = (const int*)(base + header->offsets_pos);
+    if (offsets[0] != 0 || offsets[header->num_components] != header->num_vertices) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    scc_result_t* result = scc_malloc(sizeof(scc_result_t));
+    if (!result) {
+        scc_unmap_file(data, size);
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+
+    result->num_vertices = (int)header->num_vertices;
+    result->num_components = (int)header->num_components;
+    result->largest_component_size = (int)header->largest_component_size;
+    result->smallest_component_size = (int)header->smallest_component_size;
+    result->average_component_size = header->average_component_size;
+    result->vertex_to_component = (int*)(base + header->vertex_to_component_pos);
+    result->component_offsets = (int*)offsets;
+    result->vertices = (int*)(base + header->vertices_pos);
+    result->mapping = data;
+    result->mapping_size = size;
+
+    return result;
 }
 
 // 결과 분석 함수들
@@ -101,7 +337,7 @@ int scc_get_component_size(const scc_result_t* result, int component_id) {
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
         return -1;
     }
-    return result->components[component_id].size;
+    return result->component_offsets[component_id + 1] - result->component_offsets[component_id];
 }
 
 int scc_get_vertex_component(const scc_result_t* result, int vertex) {
@@ -110,8 +346,7 @@ int scc_get_vertex_component(const scc_result_t* result, int vertex) {
         return -1;
     }
     
-    // vertex 범위 검사 (총 정점 수를 알 수 없으므로 간접적으로 확인)
-    if (vertex < 0) {
+    if (vertex < 0 || vertex >= result->num_vertices) {
         scc_set_error(SCC_ERROR_INVALID_VERTEX);
         return -1;
     }
@@ -124,7 +359,7 @@ const int* scc_get_component_vertices(const scc_result_t* result, int component_
         scc_set_error(SCC_ERROR_INVALID_PARAMETER);
         return NULL;
     }
-    return result->components[component_id].vertices;
+    return result->vertices + result->component_offsets[component_id];
 }
 
 // 그래프 속성 함수들
@@ -157,17 +392,15 @@ graph_t* scc_build_condensation_graph(const graph_t* graph, const scc_result_t*
     }
     
     // 모든 컴포넌트에 대해 정점 추가
-    for (int i = 0; i < scc->num_components; i++) {
-        if (graph_add_vertex(condensed) != i) {
-            graph_destroy(condensed);
-            return NULL;
-        }
+    if (graph_add_vertices(condensed, scc->num_components) < 0) {
+        graph_destroy(condensed);
+        return NULL;
     }
     
     // 컴포넌트 간 간선 추가
     int num_vertices = graph_get_vertex_count(graph);
     for (int v = 0; v < num_vertices; v++) {
-        vertex_t* vertex = graph->vertices[v];
+        vertex_t* vertex = &graph->vertices[v];
         int src_comp = scc->vertex_to_component[v];
         
         edge_t* edge = vertex->edges;
@@ -209,6 +442,184 @@ scc_result_t* scc_find(const graph_t* graph) {
     }
 }
 
+// 재사용 컨텍스트
+// 상태와 결과 버퍼는 처음 필요할 때 만들고 이후에는 더 큰 그래프에서만 확장함
+scc_context_t* scc_context_create(int initial_capacity) {
+    if (initial_capacity < 0) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+    
+    scc_context_t* ctx = scc_malloc(sizeof(scc_context_t));
+    if (!ctx) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return NULL;
+    }
+    
+    ctx->tarjan = NULL;
+    ctx->kosaraju = NULL;
+    ctx->result = NULL;
+    ctx->result_capacity = 0;
+    ctx->initial_capacity = initial_capacity;
+    
+    return ctx;
+}
+
+void scc_context_destroy(scc_context_t* ctx) {
+    if (!ctx) return;
+    
+    scc_result_destroy(ctx->result);
+    kosaraju_state_destroy(ctx->kosaraju);
+    tarjan_state_destroy(ctx->tarjan);
+    scc_free(ctx);
+}
+
+// 결과 버퍼를 num_vertices개 이상으로 맞춤
+static int context_prepare_result(scc_context_t* ctx, int num_vertices) {
+    if (ctx->result_capacity >= num_vertices) {
+        return SCC_SUCCESS;
+    }
+    
+    scc_result_t* result = scc_result_create(num_vertices);
+    if (!result) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    scc_result_destroy(ctx->result);
+    ctx->result = result;
+    ctx->result_capacity = num_vertices;
+    return SCC_SUCCESS;
+}
+
+// Tarjan 상태를 준비하고 컨텍스트의 결과 버퍼를 연결
+static tarjan_state_t* context_tarjan_state(scc_context_t* ctx, int num_vertices) {
+    if (!ctx->tarjan) {
+        int capacity = (num_vertices > ctx->initial_capacity) ? num_vertices : ctx->initial_capacity;
+        ctx->tarjan = tarjan_state_create(capacity);
+        if (!ctx->tarjan) {
+            return NULL;
+        }
+        // 결과는 컨텍스트가 소유하므로 상태가 만든 결과는 버림
+        scc_result_destroy(ctx->tarjan->result);
+        ctx->tarjan->result = NULL;
+    } else if (tarjan_state_reserve(ctx->tarjan, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    
+    if (context_prepare_result(ctx, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    ctx->tarjan->result = ctx->result;
+    return ctx->tarjan;
+}
+
+// Kosaraju 상태를 준비하고 컨텍스트의 결과 버퍼를 연결
+static kosaraju_state_t* context_kosaraju_state(scc_context_t* ctx, int num_vertices) {
+    if (!ctx->kosaraju) {
+        int capacity = (num_vertices > ctx->initial_capacity) ? num_vertices : ctx->initial_capacity;
+        ctx->kosaraju = kosaraju_state_create(capacity);
+        if (!ctx->kosaraju) {
+            return NULL;
+        }
+        scc_result_destroy(ctx->kosaraju->result);
+        ctx->kosaraju->result = NULL;
+    } else if (kosaraju_state_reserve(ctx->kosaraju, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    
+    if (context_prepare_result(ctx, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    ctx->kosaraju->result = ctx->result;
+    return ctx->kosaraju;
+}
+
+const scc_result_t* scc_find_tarjan_ctx(const graph_t* graph, scc_context_t* ctx) {
+    if (!graph || !ctx) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    int num_vertices = graph_get_vertex_count(graph);
+    if (num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    tarjan_state_t* state = context_tarjan_state(ctx, num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    scc_result_t* result = scc_tarjan_internal(graph, state);
+    state->result = NULL; // 실패해도 버퍼는 컨텍스트가 소유
+    return result;
+}
+
+const scc_result_t* scc_find_kosaraju_ctx(const graph_t* graph, scc_context_t* ctx) {
+    if (!graph || !ctx) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    int num_vertices = graph_get_vertex_count(graph);
+    if (num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    kosaraju_state_t* state = context_kosaraju_state(ctx, num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    scc_result_t* result = scc_kosaraju_internal(graph, state);
+    state->result = NULL;
+    return result;
+}
+
+const scc_result_t* scc_find_tarjan_csr_ctx(const csr_graph_t* csr, scc_context_t* ctx) {
+    if (!csr || !ctx) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    if (csr->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    tarjan_state_t* state = context_tarjan_state(ctx, csr->num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    scc_result_t* result = scc_tarjan_csr_internal(csr, state);
+    state->result = NULL;
+    return result;
+}
+
+const scc_result_t* scc_find_kosaraju_csr_ctx(const csr_graph_t* csr, scc_context_t* ctx) {
+    if (!csr || !ctx) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    if (csr->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    kosaraju_state_t* state = context_kosaraju_state(ctx, csr->num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    scc_result_t* result = scc_kosaraju_csr_internal(csr, state);
+    state->result = NULL;
+    return result;
+}
+
 // 통계 출력 함수들
 void scc_print_statistics(const scc_result_t* result) {
     if (!result) {
@@ -231,13 +642,14 @@ void scc_print_components(const scc_result_t* result) {
     
     printf("강한 연결 요소들:\n");
     for (int i = 0; i < result->num_components; i++) {
-        scc_component_t* comp = &result->components[i];
-        printf("  컴포넌트 %d (%d개 정점): ", i, comp->size);
+        int size = scc_get_component_size(result, i);
+        const int* vertices = scc_get_component_vertices(result, i);
+        printf("  컴포넌트 %d (%d개 정점): ", i, size);
         
-        for (int j = 0; j < comp->size; j++) {
-            printf("%d ", comp->vertices[j]);
-            if (j > 10 && comp->size > 15) { // 너무 길면 생략
-                printf("... (총 %d개)", comp->size);
+        for (int j = 0; j < size; j++) {
+            printf("%d ", vertices[j]);
+            if (j > 10 && size > 15) { // 너무 길면 생략
+                printf("... (총 %d개)", size);
                 break;
             }
         }
@@ -5,9 +5,16 @@
 #include <assert.h>
 
 // 내부 헬퍼 함수들
-static void tarjan_dfs_recursive(const graph_t* graph, int vertex, tarjan_state_t* state);
 static void tarjan_extract_scc(tarjan_state_t* state, int root);
 static int tarjan_ensure_stack_capacity(tarjan_state_t* state, int required_capacity);
+static int tarjan_ensure_frame_capacity(tarjan_state_t* state, int required_capacity);
+static int tarjan_ensure_edge_frame_capacity(tarjan_state_t* state, int required_capacity);
+static int tarjan_begin_run(tarjan_state_t* state, int num_vertices);
+static int tarjan_graph_dfs(const graph_t* graph, int root, tarjan_state_t* state);
+static int tarjan_csr_dfs(const csr_graph_t* csr, int root, tarjan_state_t* state);
+#ifdef SCC_ENABLE_PROFILING
+static void tarjan_profile_finish(tarjan_state_t* state);
+#endif
 
 // Tarjan 상태 관리
 tarjan_state_t* tarjan_state_create(int num_vertices) {
@@ -16,7 +23,7 @@ tarjan_state_t* tarjan_state_create(int num_vertices) {
         return NULL;
     }
     
-    tarjan_state_t* state = malloc(sizeof(tarjan_state_t));
+    tarjan_state_t* state = scc_malloc(sizeof(tarjan_state_t));
     if (!state) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
@@ -24,92 +31,129 @@ tarjan_state_t* tarjan_state_create(int num_vertices) {
     
     // 스택 초기화
     state->stack_capacity = num_vertices;
-    state->stack = malloc(state->stack_capacity * sizeof(int));
+    state->stack = scc_malloc(state->stack_capacity * sizeof(int));
     if (!state->stack) {
-        free(state);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
     state->stack_top = 0;
     state->current_index = 0;
+    state->max_depth = 0;
+    state->stats = NULL;
     state->current_component = 0;
     
     // 정점 처리 상태 배열
-    state->vertices_processed = calloc(num_vertices, sizeof(bool));
+    state->vertices_processed = scc_calloc(num_vertices, sizeof(bool));
     if (!state->vertices_processed) {
-        free(state->stack);
-        free(state);
+        scc_free(state->stack);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    // 결과 구조 초기화
-    state->result = malloc(sizeof(scc_result_t));
-    if (!state->result) {
-        free(state->vertices_processed);
-        free(state->stack);
-        free(state);
+    // 정점별 배열과 DFS 프레임 (프레임은 필요 시 확장)
+    state->vertex_capacity = num_vertices;
+    state->frame_capacity = (num_vertices < 64) ? num_vertices : 64;
+    state->edge_frame_capacity = state->frame_capacity;
+    state->index = scc_malloc(num_vertices * sizeof(int));
+    state->lowlink = scc_malloc(num_vertices * sizeof(int));
+    state->on_stack = scc_calloc(num_vertices, sizeof(bool));
+    state->frames = scc_malloc(state->frame_capacity * sizeof(dfs_frame_t));
+    state->edge_frames = scc_malloc(state->edge_frame_capacity * sizeof(edge_frame_t));
+    if (!state->index || !state->lowlink || !state->on_stack ||
+        !state->frames || !state->edge_frames) {
+        scc_free(state->edge_frames);
+        scc_free(state->frames);
+        scc_free(state->on_stack);
+        scc_free(state->lowlink);
+        scc_free(state->index);
+        scc_free(state->vertices_processed);
+        scc_free(state->stack);
+        scc_free(state);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    state->result->components = malloc(num_vertices * sizeof(scc_component_t));
-    state->result->vertex_to_component = malloc(num_vertices * sizeof(int));
-    if (!state->result->components || !state->result->vertex_to_component) {
-        free(state->result->vertex_to_component);
-        free(state->result->components);
-        free(state->result);
-        free(state->vertices_processed);
-        free(state->stack);
-        free(state);
-        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+    // 결과 구조 초기화 (평탄 레이아웃)
+    state->result = scc_result_create(num_vertices);
+    if (!state->result) {
+        scc_free(state->edge_frames);
+        scc_free(state->frames);
+        scc_free(state->on_stack);
+        scc_free(state->lowlink);
+        scc_free(state->index);
+        scc_free(state->vertices_processed);
+        scc_free(state->stack);
+        scc_free(state);
         return NULL;
     }
     
-    // 컴포넌트 초기화
-    for (int i = 0; i < num_vertices; i++) {
-        state->result->components[i].vertices = malloc(num_vertices * sizeof(int));
-        if (!state->result->components[i].vertices) {
-            // 이전에 할당된 컴포넌트들 정리
-            for (int j = 0; j < i; j++) {
-                free(state->result->components[j].vertices);
-            }
-            free(state->result->vertex_to_component);
-            free(state->result->components);
-            free(state->result);
-            free(state->vertices_processed);
-            free(state->stack);
-            free(state);
-            scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
-            return NULL;
-        }
-        state->result->components[i].size = 0;
-        state->result->components[i].capacity = num_vertices;
-    }
-    
-    state->result->num_components = 0;
-    
     return state;
 }
 
 void tarjan_state_destroy(tarjan_state_t* state) {
     if (!state) return;
     
-    if (state->result) {
-        if (state->result->components) {
-            for (int i = 0; i < state->result->num_components; i++) {
-                free(state->result->components[i].vertices);
-            }
-            free(state->result->components);
-        }
-        free(state->result->vertex_to_component);
-        free(state->result);
+    scc_result_destroy(state->result);
+    
+    scc_free(state->edge_frames);
+    scc_free(state->frames);
+    scc_free(state->on_stack);
+    scc_free(state->lowlink);
+    scc_free(state->index);
+    scc_free(state->vertices_processed);
+    scc_free(state->stack);
+    scc_free(state);
+}
+
+// 정점별 배열과 스택을 num_vertices개까지 확장 (줄이지 않음)
+// 재사용 컨텍스트가 더 큰 그래프를 만날 때만 할당이 일어남
+int tarjan_state_reserve(tarjan_state_t* state, int num_vertices) {
+    if (!state) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return SCC_ERROR_NULL_POINTER;
+    }
+    
+    if (tarjan_ensure_stack_capacity(state, num_vertices) != SCC_SUCCESS) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    if (state->vertex_capacity >= num_vertices) {
+        return SCC_SUCCESS;
+    }
+    
+    int* index = scc_realloc(state->index, num_vertices * sizeof(int));
+    if (!index) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    state->index = index;
+    
+    int* lowlink = scc_realloc(state->lowlink, num_vertices * sizeof(int));
+    if (!lowlink) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    state->lowlink = lowlink;
+    
+    bool* on_stack = scc_realloc(state->on_stack, num_vertices * sizeof(bool));
+    if (!on_stack) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
     }
+    state->on_stack = on_stack;
     
-    free(state->vertices_processed);
-    free(state->stack);
-    free(state);
+    bool* processed = scc_realloc(state->vertices_processed, num_vertices * sizeof(bool));
+    if (!processed) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    state->vertices_processed = processed;
+    
+    state->vertex_capacity = num_vertices;
+    return SCC_SUCCESS;
 }
 
 // 스택 연산
@@ -153,7 +197,8 @@ bool tarjan_stack_is_empty(const tarjan_state_t* state) {
     return !state || state->stack_top == 0;
 }
 
-// Tarjan 알고리즘 메인 구현
+// Tarjan 알고리즘 메인 구현 (명시적 스택 사용, 재귀 없음)
+// 같은 상태로 여러 번 호출할 수 있으며 스택과 프레임 배열은 재사용됨
 scc_result_t* scc_tarjan_internal(const graph_t* graph, tarjan_state_t* state) {
     if (!graph || !state) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
@@ -161,41 +206,26 @@ scc_result_t* scc_tarjan_internal(const graph_t* graph, tarjan_state_t* state) {
     }
     
     int num_vertices = graph_get_vertex_count(graph);
-    if (num_vertices <= 0) {
-        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+    if (tarjan_begin_run(state, num_vertices) != SCC_SUCCESS) {
         return NULL;
     }
     
-    // 모든 정점의 알고리즘 필드 초기화
-    for (int i = 0; i < num_vertices; i++) {
-        vertex_t* v = graph->vertices[i];
-        v->index = -1;
-        v->lowlink = -1;
-        v->on_stack = false;
-    }
-    
     // 모든 정점에 대해 DFS 수행
+    SCC_PHASE_START(state->stats, dfs_start);
     for (int i = 0; i < num_vertices; i++) {
-        if (graph->vertices[i]->index == -1) {
-            tarjan_dfs_recursive(graph, i, state);
+        if (state->index[i] == -1) {
+            if (tarjan_graph_dfs(graph, i, state) != SCC_SUCCESS) {
+                return NULL;
+            }
         }
     }
+    SCC_PHASE_STOP(state->stats, tarjan_dfs_ms, dfs_start);
     
     // 통계 계산
-    int largest = 0, smallest = num_vertices + 1;
-    int total_vertices = 0;
-    
-    for (int i = 0; i < state->result->num_components; i++) {
-        int size = state->result->components[i].size;
-        if (size > largest) largest = size;
-        if (size < smallest) smallest = size;
-        total_vertices += size;
-    }
-    
-    state->result->largest_component_size = largest;
-    state->result->smallest_component_size = (state->result->num_components > 0) ? smallest : 0;
-    state->result->average_component_size = (state->result->num_components > 0) ? 
-        (double)total_vertices / state->result->num_components : 0.0;
+    SCC_PHASE_START(state->stats, statistics_start);
+    scc_result_compute_statistics(state->result);
+    SCC_PHASE_STOP(state->stats, statistics_ms, statistics_start);
+    SCC_PROFILE(tarjan_profile_finish(state);)
     
     // 결과 반환 (상태에서 분리하여 반환)
     scc_result_t* result = state->result;
@@ -204,12 +234,26 @@ scc_result_t* scc_tarjan_internal(const graph_t* graph, tarjan_state_t* state) {
     return result;
 }
 
+// 단일 루트에서의 DFS (정점별 상태는 호출자가 초기화해야 함)
 void tarjan_dfs(const graph_t* graph, int vertex, tarjan_state_t* state) {
-    tarjan_dfs_recursive(graph, vertex, state);
+    if (!graph || !state || !state->result ||
+        vertex < 0 || vertex >= graph->num_vertices || vertex >= state->vertex_capacity) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return;
+    }
+    tarjan_graph_dfs(graph, vertex, state);
 }
 
 // 공개 API 함수
 scc_result_t* scc_find_tarjan(const graph_t* graph) {
+    return scc_find_tarjan_stats(graph, NULL);
+}
+
+// stats의 총 시간과 할당 수에는 상태 생성과 해제도 포함됨
+scc_result_t* scc_find_tarjan_stats(const graph_t* graph, scc_stats_t* stats) {
+    scc_profile_run_t run;
+    scc_profile_begin(&run, stats);
+    
     if (!graph) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
         return NULL;
@@ -226,73 +270,151 @@ scc_result_t* scc_find_tarjan(const graph_t* graph) {
         return NULL;
     }
     
+    state->stats = stats;
     scc_result_t* result = scc_tarjan_internal(graph, state);
     tarjan_state_destroy(state);
     
+    scc_profile_end(&run, stats);
+    return result;
+}
+
+// CSR 그래프 위의 Tarjan 알고리즘 (명시적 스택 사용)
+scc_result_t* scc_tarjan_csr_internal(const csr_graph_t* csr, tarjan_state_t* state) {
+    if (!csr || !state) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    int num_vertices = csr->num_vertices;
+    if (tarjan_begin_run(state, num_vertices) != SCC_SUCCESS) {
+        return NULL;
+    }
+    
+    SCC_PHASE_START(state->stats, dfs_start);
+    for (int i = 0; i < num_vertices; i++) {
+        if (state->index[i] == -1) {
+            if (tarjan_csr_dfs(csr, i, state) != SCC_SUCCESS) {
+                return NULL;
+            }
+        }
+    }
+    SCC_PHASE_STOP(state->stats, tarjan_dfs_ms, dfs_start);
+    
+    SCC_PHASE_START(state->stats, statistics_start);
+    scc_result_compute_statistics(state->result);
+    SCC_PHASE_STOP(state->stats, statistics_ms, statistics_start);
+    SCC_PROFILE(tarjan_profile_finish(state);)
+    
+    // 결과 반환 (상태에서 분리하여 반환)
+    scc_result_t* result = state->result;
+    state->result = NULL; // 이중 해제 방지
+    
+    return result;
+}
+
+scc_result_t* scc_find_tarjan_csr(const csr_graph_t* csr) {
+    return scc_find_tarjan_csr_stats(csr, NULL);
+}
+
+scc_result_t* scc_find_tarjan_csr_stats(const csr_graph_t* csr, scc_stats_t* stats) {
+    scc_profile_run_t run;
+    scc_profile_begin(&run, stats);
+    
+    if (!csr) {
+        scc_set_error(SCC_ERROR_NULL_POINTER);
+        return NULL;
+    }
+    
+    if (csr->num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return NULL;
+    }
+    
+    tarjan_state_t* state = tarjan_state_create(csr->num_vertices);
+    if (!state) {
+        return NULL;
+    }
+    
+    state->stats = stats;
+    scc_result_t* result = scc_tarjan_csr_internal(csr, state);
+    tarjan_state_destroy(state);
+    
+    scc_profile_end(&run, stats);
     return result;
 }
 
 // 내부 헬퍼 함수들 구현
-static void tarjan_dfs_recursive(const graph_t* graph, int v, tarjan_state_t* state) {
-    vertex_t* vertex = graph->vertices[v];
-    
-    // 정점 초기화
-    vertex->index = vertex->lowlink = state->current_index++;
-    vertex->on_stack = true;
-    tarjan_stack_push(state, v);
-    
-    // 모든 인접 정점 탐색
-    edge_t* edge = vertex->edges;
-    while (edge) {
-        int w = edge->dest;
-        vertex_t* adj_vertex = graph->vertices[w];
-        
-        if (adj_vertex->index == -1) {
-            // 트리 간선: 재귀 호출
-            tarjan_dfs_recursive(graph, w, state);
-            vertex->lowlink = (vertex->lowlink < adj_vertex->lowlink) ? 
-                             vertex->lowlink : adj_vertex->lowlink;
-        } else if (adj_vertex->on_stack) {
-            // 후진 간선: lowlink 업데이트
-            vertex->lowlink = (vertex->lowlink < adj_vertex->index) ? 
-                             vertex->lowlink : adj_vertex->index;
+
+// 실행 시작 전 상태 초기화
+// 이전 실행에서 분리된 결과는 새로 만들고, 정점별 배열은 재설정함
+static int tarjan_begin_run(tarjan_state_t* state, int num_vertices) {
+    if (num_vertices <= 0) {
+        scc_set_error(SCC_ERROR_GRAPH_EMPTY);
+        return SCC_ERROR_GRAPH_EMPTY;
+    }
+    
+    if (num_vertices > state->vertex_capacity) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return SCC_ERROR_INVALID_PARAMETER;
+    }
+    
+    if (!state->result) {
+        state->result = scc_result_create(num_vertices);
+        if (!state->result) {
+            return SCC_ERROR_MEMORY_ALLOCATION;
         }
-        // 전진/교차 간선은 무시
-        
-        edge = edge->next;
     }
+    state->result->num_vertices = num_vertices;
+    state->result->num_components = 0;
+    state->result->component_offsets[0] = 0;
     
-    // SCC 루트인지 확인
-    if (vertex->lowlink == vertex->index) {
-        tarjan_extract_scc(state, v);
+    for (int i = 0; i < num_vertices; i++) {
+        state->index[i] = -1;
+        state->on_stack[i] = false;
     }
+    
+    state->stack_top = 0;
+    state->current_index = 0;
+    state->current_component = 0;
+    state->max_depth = 0;
+    
+    return SCC_SUCCESS;
 }
 
+// 스택에서 루트까지 꺼내 하나의 컴포넌트로 기록
 static void tarjan_extract_scc(tarjan_state_t* state, int root) {
-    scc_component_t* component = &state->result->components[state->current_component];
+    scc_result_t* result = state->result;
+    bool* on_stack = state->on_stack;
+    int pos = result->component_offsets[result->num_components];
     int w;
     
     do {
-        w = tarjan_stack_pop(state);
-        // 더 이상 스택에 없음을 표시
-        // vertex를 직접 접근할 수 없으므로 별도 추적이 필요함
-        
-        // 컴포넌트에 정점 추가
-        component->vertices[component->size++] = w;
-        state->result->vertex_to_component[w] = state->current_component;
-        
+        w = state->stack[--state->stack_top];
+        on_stack[w] = false;
+        result->vertices[pos++] = w;
+        result->vertex_to_component[w] = state->current_component;
     } while (w != root);
     
     state->current_component++;
-    state->result->num_components++;
+    result->num_components++;
+    result->component_offsets[result->num_components] = pos;
 }
 
+#ifdef SCC_ENABLE_PROFILING
+// 최대 깊이는 상태에 누적되므로 실행이 끝난 뒤 한 번만 기록
+static void tarjan_profile_finish(tarjan_state_t* state) {
+    if (!state->stats) return;
+    
+    scc_profile_add_dfs(state->stats, 0, 0, state->max_depth);
+}
+#endif
+
 static int tarjan_ensure_stack_capacity(tarjan_state_t* state, int required_capacity) {
     if (state->stack_capacity >= required_capacity) {
         return SCC_SUCCESS;
     }
     
-    int* new_stack = realloc(state->stack, required_capacity * sizeof(int));
+    int* new_stack = scc_realloc(state->stack, required_capacity * sizeof(int));
     if (!new_stack) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return SCC_ERROR_MEMORY_ALLOCATION;
@@ -302,4 +424,183 @@ static int tarjan_ensure_stack_capacity(tarjan_state_t* state, int required_capa
     state->stack_capacity = required_capacity;
     
     return SCC_SUCCESS;
-}
\ No newline at end of file
+}
+
+static int tarjan_ensure_frame_capacity(tarjan_state_t* state, int required_capacity) {
+    if (state->frame_capacity >= required_capacity) {
+        return SCC_SUCCESS;
+    }
+    
+    int new_capacity = state->frame_capacity > 0 ? state->frame_capacity : 64;
+    while (new_capacity < required_capacity) new_capacity *= 2;
+    
+    dfs_frame_t* new_frames = scc_realloc(state->frames, new_capacity * sizeof(dfs_frame_t));
+    if (!new_frames) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    state->frames = new_frames;
+    state->frame_capacity = new_capacity;
+    
+    return SCC_SUCCESS;
+}
+
+static int tarjan_ensure_edge_frame_capacity(tarjan_state_t* state, int required_capacity) {
+    if (state->edge_frame_capacity >= required_capacity) {
+        return SCC_SUCCESS;
+    }
+    
+    int new_capacity = state->edge_frame_capacity > 0 ? state->edge_frame_capacity : 64;
+    while (new_capacity < required_capacity) new_capacity *= 2;
+    
+    edge_frame_t* new_frames = scc_realloc(state->edge_frames, new_capacity * sizeof(edge_frame_t));
+    if (!new_frames) {
+        scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    state->edge_frames = new_frames;
+    state->edge_frame_capacity = new_capacity;
+    
+    return SCC_SUCCESS;
+}
+
+// 연결 리스트 그래프 위의 반복형 Tarjan DFS
+// 각 프레임은 다음에 검사할 간선 포인터를 기억하므로 호출 스택 깊이가
+// 그래프 깊이와 무관함
+static int tarjan_graph_dfs(const graph_t* graph, int root, tarjan_state_t* state) {
+    const vertex_t* vertices = graph->vertices;
+    int* index = state->index;
+    int* lowlink = state->lowlink;
+    bool* on_stack = state->on_stack;
+    int depth = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1; int64_t popped = 0;)
+    
+    if (tarjan_ensure_edge_frame_capacity(state, 1) != SCC_SUCCESS) {
+        return SCC_ERROR_MEMORY_ALLOCATION;
+    }
+    
+    index[root] = lowlink[root] = state->current_index++;
+    on_stack[root] = true;
+    state->stack[state->stack_top++] = root;
+    state->edge_frames[depth].vertex = root;
+    state->edge_frames[depth].next_edge = vertices[root].edges;
+    depth++;
+    if (depth > state->max_depth) state->max_depth = depth;
+    
+    while (depth > 0) {
+        edge_frame_t* frame = &state->edge_frames[depth - 1];
+        int v = frame->vertex;
+        const edge_t* edge = frame->next_edge;
+        
+        if (edge) {
+            int w = edge->dest;
+            frame->next_edge = edge->next;
+            SCC_PROFILE(edges_scanned++;)
+            
+            if (index[w] == -1) {
+                // 트리 간선: 새 프레임 push
+                if (tarjan_ensure_edge_frame_capacity(state, depth + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                index[w] = lowlink[w] = state->current_index++;
+                on_stack[w] = true;
+                state->stack[state->stack_top++] = w;
+                state->edge_frames[depth].vertex = w;
+                state->edge_frames[depth].next_edge = vertices[w].edges;
+                depth++;
+                if (depth > state->max_depth) state->max_depth = depth;
+                SCC_PROFILE(pushes++;)
+            } else if (on_stack[w] && index[w] < lowlink[v]) {
+                // 후진 간선: lowlink 업데이트
+                lowlink[v] = index[w];
+            }
+            // 전진/교차 간선은 무시
+            continue;
+        }
+        
+        // 모든 간선 처리 완료: SCC 루트면 추출
+        if (lowlink[v] == index[v]) {
+            SCC_PROFILE(int stack_top = state->stack_top;)
+            tarjan_extract_scc(state, v);
+            SCC_PROFILE(popped += stack_top - state->stack_top;)
+        }
+        
+        depth--;
+        if (depth > 0) {
+            int parent = state->edge_frames[depth - 1].vertex;
+            if (lowlink[v] < lowlink[parent]) lowlink[parent] = lowlink[v];
+        }
+    }
+    
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, 0);)
+    SCC_PROFILE(if (state->stats) state->stats->vertices_extracted += popped;)
+    return SCC_SUCCESS;
+}
+
+// 루트에서 시작하는 반복형 Tarjan DFS
+// 각 프레임은 다음에 검사할 간선 위치를 기억하므로 재귀 없이 동작함
+static int tarjan_csr_dfs(const csr_graph_t* csr, int root, tarjan_state_t* state) {
+    const int64_t* offsets = csr->offsets;
+    const int* targets = csr->targets;
+    int* index = state->index;
+    int* lowlink = state->lowlink;
+    bool* on_stack = state->on_stack;
+    int depth = 0;
+    SCC_PROFILE(int64_t edges_scanned = 0; int64_t pushes = 1; int64_t popped = 0;)
+    
+    index[root] = lowlink[root] = state->current_index++;
+    on_stack[root] = true;
+    state->stack[state->stack_top++] = root;
+    state->frames[depth].vertex = root;
+    state->frames[depth].next_edge = offsets[root];
+    depth++;
+    if (depth > state->max_depth) state->max_depth = depth;
+    
+    while (depth > 0) {
+        dfs_frame_t* frame = &state->frames[depth - 1];
+        int v = frame->vertex;
+        
+        if (frame->next_edge < offsets[v + 1]) {
+            int w = targets[frame->next_edge++];
+            SCC_PROFILE(edges_scanned++;)
+            
+            if (index[w] == -1) {
+                // 트리 간선: 새 프레임 push
+                if (tarjan_ensure_frame_capacity(state, depth + 1) != SCC_SUCCESS) {
+                    return SCC_ERROR_MEMORY_ALLOCATION;
+                }
+                index[w] = lowlink[w] = state->current_index++;
+                on_stack[w] = true;
+                state->stack[state->stack_top++] = w;
+                state->frames[depth].vertex = w;
+                state->frames[depth].next_edge = offsets[w];
+                depth++;
+                if (depth > state->max_depth) state->max_depth = depth;
+                SCC_PROFILE(pushes++;)
+            } else if (on_stack[w] && index[w] < lowlink[v]) {
+                // 후진 간선: lowlink 업데이트
+                lowlink[v] = index[w];
+            }
+            continue;
+        }
+        
+        // 모든 간선 처리 완료: SCC 루트면 추출
+        if (lowlink[v] == index[v]) {
+            SCC_PROFILE(int stack_top = state->stack_top;)
+            tarjan_extract_scc(state, v);
+            SCC_PROFILE(popped += stack_top - state->stack_top;)
+        }
+        
+        depth--;
+        if (depth > 0) {
+            int parent = state->frames[depth - 1].vertex;
+            if (lowlink[v] < lowlink[parent]) lowlink[parent] = lowlink[v];
+        }
+    }
+    
+    SCC_PROFILE(scc_profile_add_dfs(state->stats, edges_scanned, pushes, 0);)
+    SCC_PROFILE(if (state->stats) state->stats->vertices_extracted += popped;)
+    return SCC_SUCCESS;
+}
@@ -1,4 +1,9 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "scc.h"
+#include "graph.h"
 #include "scc_algorithms.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -6,6 +11,10 @@
 #include <time.h>
 #include <assert.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
 // 그래프 순회 함수들
 void graph_dfs(const graph_t* graph, int start_vertex, 
                vertex_visit_func_t visit_func, void* user_data) {
@@ -16,16 +25,16 @@ void graph_dfs(const graph_t* graph, int start_vertex,
     }
     
     int num_vertices = graph_get_vertex_count(graph);
-    bool* visited = calloc(num_vertices, sizeof(bool));
+    bool* visited = scc_calloc(num_vertices, sizeof(bool));
     if (!visited) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return;
     }
     
     // DFS 스택 (재귀 대신 명시적 스택 사용)
-    int* stack = malloc(num_vertices * sizeof(int));
+    int* stack = scc_malloc(num_vertices * sizeof(int));
     if (!stack) {
-        free(visited);
+        scc_free(visited);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return;
     }
@@ -41,7 +50,7 @@ void graph_dfs(const graph_t* graph, int start_vertex,
             visit_func(current, user_data);
             
             // 모든 인접 정점을 스택에 추가
-            vertex_t* vertex = graph->vertices[current];
+            vertex_t* vertex = &graph->vertices[current];
             edge_t* edge = vertex->edges;
             while (edge) {
                 if (!visited[edge->dest]) {
@@ -52,8 +61,8 @@ void graph_dfs(const graph_t* graph, int start_vertex,
         }
     }
     
-    free(stack);
-    free(visited);
+    scc_free(stack);
+    scc_free(visited);
 }
 
 void graph_bfs(const graph_t* graph, int start_vertex,
@@ -65,16 +74,16 @@ void graph_bfs(const graph_t* graph, int start_vertex,
     }
     
     int num_vertices = graph_get_vertex_count(graph);
-    bool* visited = calloc(num_vertices, sizeof(bool));
+    bool* visited = scc_calloc(num_vertices, sizeof(bool));
     if (!visited) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return;
     }
     
     // BFS 큐
-    int* queue = malloc(num_vertices * sizeof(int));
+    int* queue = scc_malloc(num_vertices * sizeof(int));
     if (!queue) {
-        free(visited);
+        scc_free(visited);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return;
     }
@@ -88,7 +97,7 @@ void graph_bfs(const graph_t* graph, int start_vertex,
         visit_func(current, user_data);
         
         // 모든 인접 정점을 큐에 추가
-        vertex_t* vertex = graph->vertices[current];
+        vertex_t* vertex = &graph->vertices[current];
         edge_t* edge = vertex->edges;
         while (edge) {
             if (!visited[edge->dest]) {
@@ -99,8 +108,8 @@ void graph_bfs(const graph_t* graph, int start_vertex,
         }
     }
     
-    free(queue);
-    free(visited);
+    scc_free(queue);
+    scc_free(visited);
 }
 
 // 그래프 검증 함수
@@ -117,7 +126,7 @@ int graph_verify_integrity(const graph_t* graph) {
     int calculated_edges = 0;
     
     for (int i = 0; i < graph->num_vertices; i++) {
-        vertex_t* vertex = graph->vertices[i];
+        vertex_t* vertex = &graph->vertices[i];
         
         // 정점 ID 검사
         if (vertex->id != i) {
@@ -155,7 +164,7 @@ graph_edge_iterator_t* graph_edge_iterator_create(const graph_t* graph) {
         return NULL;
     }
     
-    graph_edge_iterator_t* iter = malloc(sizeof(graph_edge_iterator_t));
+    graph_edge_iterator_t* iter = scc_malloc(sizeof(graph_edge_iterator_t));
     if (!iter) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
@@ -167,8 +176,8 @@ graph_edge_iterator_t* graph_edge_iterator_create(const graph_t* graph) {
     
     // 첫 번째 간선 찾기
     while (iter->current_vertex < graph->num_vertices) {
-        if (graph->vertices[iter->current_vertex]->edges) {
-            iter->current_edge = graph->vertices[iter->current_vertex]->edges;
+        if (graph->vertices[iter->current_vertex].edges) {
+            iter->current_edge = graph->vertices[iter->current_vertex].edges;
             break;
         }
         iter->current_vertex++;
@@ -178,7 +187,7 @@ graph_edge_iterator_t* graph_edge_iterator_create(const graph_t* graph) {
 }
 
 void graph_edge_iterator_destroy(graph_edge_iterator_t* iter) {
-    free(iter);
+    scc_free(iter);
 }
 
 bool graph_edge_iterator_next(graph_edge_iterator_t* iter, int* src, int* dest) {
@@ -200,7 +209,7 @@ bool graph_edge_iterator_next(graph_edge_iterator_t* iter, int* src, int* dest)
     while (!iter->current_edge && iter->current_vertex < iter->graph->num_vertices - 1) {
         iter->current_vertex++;
         if (iter->current_vertex < iter->graph->num_vertices) {
-            iter->current_edge = iter->graph->vertices[iter->current_vertex]->edges;
+            iter->current_edge = iter->graph->vertices[iter->current_vertex].edges;
         }
     }
     
@@ -215,8 +224,8 @@ void graph_edge_iterator_reset(graph_edge_iterator_t* iter) {
     
     // 첫 번째 간선 찾기
     while (iter->current_vertex < iter->graph->num_vertices) {
-        if (iter->graph->vertices[iter->current_vertex]->edges) {
-            iter->current_edge = iter->graph->vertices[iter->current_vertex]->edges;
+        if (iter->graph->vertices[iter->current_vertex].edges) {
+            iter->current_edge = iter->graph->vertices[iter->current_vertex].edges;
             break;
         }
         iter->current_vertex++;
@@ -234,105 +243,209 @@ int graph_resize(graph_t* graph, int new_capacity) {
         return SCC_SUCCESS;
     }
     
-    vertex_t** new_vertices = realloc(graph->vertices, 
-                                     new_capacity * sizeof(vertex_t*));
+    // 정점은 값으로 저장되므로 재할당으로 옮겨져도 됨 (간선 인덱스는 정점 주소를 저장하지 않음)
+    vertex_t* new_vertices = scc_realloc(graph->vertices, 
+                                     (size_t)new_capacity * sizeof(vertex_t));
     if (!new_vertices) {
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return SCC_ERROR_MEMORY_ALLOCATION;
     }
     
-    // 새로운 공간을 NULL로 초기화
-    for (int i = graph->capacity; i < new_capacity; i++) {
-        new_vertices[i] = NULL;
-    }
-    
     graph->vertices = new_vertices;
     graph->capacity = new_capacity;
     
     return SCC_SUCCESS;
 }
 
+// 단조 증가 벽시계 (밀리초)
+double scc_profile_clock_ms(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+// 단계별 통계 (scc_stats_t)
+// 프로파일링을 끄고 빌드하면 통계를 0으로만 채우고 아무것도 측정하지 않음
+void scc_profile_begin(scc_profile_run_t* run, scc_stats_t* stats) {
+    if (!stats) return;
+    
+    memset(stats, 0, sizeof(*stats));
+#ifdef SCC_ENABLE_PROFILING
+    stats->enabled = true;
+    run->allocations = scc_memory_allocation_count();
+    run->bytes_allocated = scc_memory_allocated_bytes();
+    run->start_ms = scc_profile_clock_ms();
+#else
+    (void)run;
+#endif
+}
+
+void scc_profile_end(scc_profile_run_t* run, scc_stats_t* stats) {
+#ifdef SCC_ENABLE_PROFILING
+    if (!stats) return;
+    
+    stats->total_ms = scc_profile_clock_ms() - run->start_ms;
+    stats->allocations = scc_memory_allocation_count() - run->allocations;
+    stats->bytes_allocated = scc_memory_allocated_bytes() - run->bytes_allocated;
+#else
+    (void)run;
+    (void)stats;
+#endif
+}
+
+// DFS 한 번의 지역 카운터를 합산
+void scc_profile_add_dfs(scc_stats_t* stats, int64_t edges_scanned, int64_t stack_pushes, int max_depth) {
+    if (!stats) return;
+    
+    stats->edges_scanned += edges_scanned;
+    stats->stack_pushes += stack_pushes;
+    if (max_depth > stats->max_dfs_depth) stats->max_dfs_depth = max_depth;
+}
+
 // 벤치마킹 함수
+
+// 한 번 실행: scc_find_tarjan과 같은 과정을 상태에 접근하며 수행해 DFS 깊이를 얻음
+static scc_result_t* benchmark_run_tarjan(const graph_t* graph, int* max_depth) {
+    tarjan_state_t* state = tarjan_state_create(graph_get_vertex_count(graph));
+    if (!state) return NULL;
+    
+    scc_result_t* result = scc_tarjan_internal(graph, state);
+    *max_depth = state->max_depth;
+    tarjan_state_destroy(state);
+    return result;
+}
+
+static scc_result_t* benchmark_run_kosaraju(const graph_t* graph, int* max_depth) {
+    *max_depth = 0;
+    return scc_find_kosaraju(graph);
+}
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void benchmark_timing_stats(double* times, int count, scc_timing_stats_t* stats) {
+    qsort(times, (size_t)count, sizeof(double), compare_double);
+    
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) {
+        sum += times[i];
+    }
+    
+    // p99는 최근접 순위 (ceil(0.99 n)번째 값)
+    int p99_rank = (count * 99 + 99) / 100;
+    stats->min_ms = times[0];
+    stats->max_ms = times[count - 1];
+    stats->mean_ms = sum / count;
+    stats->median_ms = (count % 2) ? times[count / 2]
+                                   : (times[count / 2 - 1] + times[count / 2]) / 2.0;
+    stats->p99_ms = times[p99_rank - 1];
+}
+
+// 준비 실행 한 번 뒤 repetitions번 측정
+// 메모리는 실행 직전 사용량을 기준으로 한 계측 할당기의 최대값 (반복 중 최대)
+// 하드웨어 카운터는 측정 반복 전체의 합 (perf가 NULL이면 측정하지 않음)
+// 마지막 결과는 *result로 넘겨 비교에 사용
+static bool benchmark_measure(const graph_t* graph,
+                              scc_result_t* (*run)(const graph_t*, int*),
+                              int repetitions, double* times, scc_timing_stats_t* stats,
+                              scc_perf_counters_t* perf, scc_hw_counters_t* counters,
+                              size_t* peak_bytes, int* max_depth, scc_result_t** result) {
+    scc_result_destroy(run(graph, max_depth));
+    
+    *result = NULL;
+    *peak_bytes = 0;
+    for (int r = 0; r < repetitions; r++) {
+        scc_result_destroy(*result);
+        
+        size_t baseline = scc_memory_current_bytes();
+        scc_memory_reset_peak();
+        scc_perf_counters_start(perf);
+        double start = scc_profile_clock_ms();
+        *result = run(graph, max_depth);
+        times[r] = scc_profile_clock_ms() - start;
+        scc_perf_counters_stop(perf, counters);
+        size_t peak = scc_memory_peak_bytes();
+        
+        if (!*result) return false;
+        if (peak > baseline && peak - baseline > *peak_bytes) {
+            *peak_bytes = peak - baseline;
+        }
+    }
+    
+    benchmark_timing_stats(times, repetitions, stats);
+    return true;
+}
+
 scc_benchmark_result_t* scc_benchmark_algorithms(const graph_t* graph) {
+    return scc_benchmark_algorithms_repeat(graph, SCC_BENCHMARK_DEFAULT_REPETITIONS);
+}
+
+scc_benchmark_result_t* scc_benchmark_algorithms_repeat(const graph_t* graph, int repetitions) {
     if (!graph) {
         scc_set_error(SCC_ERROR_NULL_POINTER);
         return NULL;
     }
+    if (repetitions < 1) {
+        scc_set_error(SCC_ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
     
-    scc_benchmark_result_t* benchmark = malloc(sizeof(scc_benchmark_result_t));
-    if (!benchmark) {
+    scc_benchmark_result_t* benchmark = scc_calloc(1, sizeof(scc_benchmark_result_t));
+    double* times = scc_malloc((size_t)repetitions * sizeof(double));
+    if (!benchmark || !times) {
+        scc_free(times);
+        scc_free(benchmark);
         scc_set_error(SCC_ERROR_MEMORY_ALLOCATION);
         return NULL;
     }
     
-    // 초기화
-    benchmark->tarjan_time_ms = 0.0;
-    benchmark->kosaraju_time_ms = 0.0;
-    benchmark->tarjan_memory_peak_bytes = 0;
-    benchmark->kosaraju_memory_peak_bytes = 0;
-    benchmark->tarjan_stack_max_depth = 0;
+    benchmark->repetitions = repetitions;
     benchmark->kosaraju_transpose_edges = graph_get_edge_count(graph);
-    benchmark->results_match = true;
     
-    clock_t start, end;
+    scc_result_t* tarjan_result = NULL;
+    scc_result_t* kosaraju_result = NULL;
+    int kosaraju_depth;
     
-    // Tarjan 알고리즘 벤치마크
-    start = clock();
-    scc_result_t* tarjan_result = scc_find_tarjan(graph);
-    end = clock();
+    // 카운터를 열 수 없으면 시간과 메모리만 측정
+    scc_perf_counters_t* perf = scc_perf_counters_open();
     
-    if (tarjan_result) {
-        benchmark->tarjan_time_ms = ((double)(end - start) / CLOCKS_PER_SEC) * 1000.0;
-        
-        // 메모리 사용량 추정 (정확한 측정은 복잡하므로 근사치 사용)
-        int num_vertices = graph_get_vertex_count(graph);
-        benchmark->tarjan_memory_peak_bytes = 
-            sizeof(tarjan_state_t) + 
-            num_vertices * sizeof(int) + // 스택
-            num_vertices * sizeof(bool) + // vertices_processed
-            sizeof(scc_result_t) +
-            tarjan_result->num_components * sizeof(scc_component_t);
-    }
+    bool tarjan_ok = benchmark_measure(graph, benchmark_run_tarjan, repetitions, times,
+                                       &benchmark->tarjan_timing,
+                                       perf, &benchmark->tarjan_counters,
+                                       &benchmark->tarjan_memory_peak_bytes,
+                                       &benchmark->tarjan_stack_max_depth, &tarjan_result);
+    bool kosaraju_ok = benchmark_measure(graph, benchmark_run_kosaraju, repetitions, times,
+                                         &benchmark->kosaraju_timing,
+                                         perf, &benchmark->kosaraju_counters,
+                                         &benchmark->kosaraju_memory_peak_bytes,
+                                         &kosaraju_depth, &kosaraju_result);
     
-    // Kosaraju 알고리즘 벤치마크
-    start = clock();
-    scc_result_t* kosaraju_result = scc_find_kosaraju(graph);
-    end = clock();
+    scc_perf_counters_close(perf);
     
-    if (kosaraju_result) {
-        benchmark->kosaraju_time_ms = ((double)(end - start) / CLOCKS_PER_SEC) * 1000.0;
-        
-        // 메모리 사용량 추정
-        int num_vertices = graph_get_vertex_count(graph);
-        int num_edges = graph_get_edge_count(graph);
-        benchmark->kosaraju_memory_peak_bytes = 
-            sizeof(kosaraju_state_t) +
-            num_vertices * sizeof(int) + // finish_order
-            2 * num_vertices * sizeof(bool) + // visited arrays
-            sizeof(graph_t) + num_vertices * sizeof(vertex_t*) + // transpose graph
-            num_edges * sizeof(edge_t) + // transpose edges
-            sizeof(scc_result_t) +
-            kosaraju_result->num_components * sizeof(scc_component_t);
-    }
+    benchmark->tarjan_time_ms = benchmark->tarjan_timing.median_ms;
+    benchmark->kosaraju_time_ms = benchmark->kosaraju_timing.median_ms;
     
-    // 결과 비교
-    if (tarjan_result && kosaraju_result) {
-        benchmark->results_match = (tarjan_result->num_components == kosaraju_result->num_components);
-        
-        // 더 자세한 비교 (선택사항)
-        if (benchmark->results_match) {
-            // 컴포넌트 크기별로 정렬하여 비교할 수 있지만, 
-            // 여기서는 간단히 컴포넌트 수만 비교
-        }
-    }
+    // 컴포넌트 수뿐 아니라 분할 전체를 비교
+    benchmark->results_match = tarjan_ok && kosaraju_ok &&
+                               scc_result_equivalent(tarjan_result, kosaraju_result);
     
-    // 정리
     scc_result_destroy(tarjan_result);
     scc_result_destroy(kosaraju_result);
+    scc_free(times);
     
     return benchmark;
 }
 
 void scc_benchmark_result_destroy(scc_benchmark_result_t* benchmark) {
-    free(benchmark);
+    scc_free(benchmark);
 }
\ No newline at end of file
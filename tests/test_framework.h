@@ -184,5 +184,7 @@ void run_utils_tests();
 void run_io_tests();
 void run_integration_tests();
 void run_performance_tests();
+void run_parallel_tests();
+void run_incremental_tests();
 
 #endif // TEST_FRAMEWORK_H
\ No newline at end of file
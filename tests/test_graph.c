@@ -1,6 +1,7 @@
 #include "test_framework.h"
 #include "../src/graph.h"
 #include <assert.h>
+#include <string.h>
 
 // 그래프 생성 테스트
 static void test_graph_create_destroy() {
@@ -203,6 +204,305 @@ static void test_graph_copy() {
     TEST_END();
 }
 
+// CSR 고정 테스트
+static void test_graph_freeze() {
+    TEST_START("Graph freeze to CSR");
+    
+    graph_t* graph = graph_create(4);
+    for (int i = 0; i < 4; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 0, 2);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 0);
+    
+    csr_graph_t* csr = graph_freeze(graph);
+    ASSERT_NOT_NULL(csr, "Freeze should succeed");
+    ASSERT_EQUAL(csr->num_vertices, 4, "CSR should have same vertex count");
+    ASSERT_EQUAL(csr->num_edges, 4, "CSR should have same edge count");
+    ASSERT_EQUAL(csr->offsets[4], 4, "Last offset should equal edge count");
+    
+    for (int v = 0; v < 4; v++) {
+        ASSERT_EQUAL(csr_graph_get_out_degree(csr, v), graph_get_out_degree(graph, v),
+                     "CSR out-degree should match graph");
+        for (int64_t e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            ASSERT_TRUE(graph_has_edge(graph, v, csr->targets[e]), "CSR edge should exist in graph");
+        }
+    }
+    
+    // 계수 정렬 전치
+    csr_graph_t* transpose = csr_graph_transpose(csr);
+    ASSERT_NOT_NULL(transpose, "CSR transpose should succeed");
+    ASSERT_EQUAL(csr_graph_get_out_degree(transpose, 0), 1, "Vertex 0 should have in-degree 1");
+    ASSERT_EQUAL(transpose->targets[transpose->offsets[0]], 3, "Edge 3->0 should be transposed");
+    
+    ASSERT_NULL(graph_freeze(NULL), "Freezing NULL should fail");
+    
+    csr_graph_destroy(transpose);
+    csr_graph_destroy(csr);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 슬랩 풀 기반 간선 할당 테스트
+static void test_graph_memory_pools() {
+    TEST_START("Slab pool backed edges");
+    
+    memory_pool_t* edge_pool = memory_pool_create(sizeof(edge_t), 8);
+    ASSERT_NOT_NULL(edge_pool, "Edge pool creation should succeed");
+    ASSERT_NULL(memory_pool_alloc(edge_pool, edge_pool->block_size + 1),
+                "Allocations larger than the slot should fail");
+    
+    // 두 그래프가 같은 풀을 공유
+    graph_t* first = graph_create_with_edge_pool(4, edge_pool);
+    graph_t* second = graph_create_with_edge_pool(4, edge_pool);
+    ASSERT_NOT_NULL(first, "Graph with an external pool should be created");
+    ASSERT_NOT_NULL(second, "Second graph sharing the pool should be created");
+    graph_add_vertices(first, 3);
+    graph_add_vertices(second, 3);
+    graph_add_edge(first, 0, 1);
+    graph_add_edge(first, 1, 2);
+    graph_add_edge(second, 2, 0);
+    ASSERT_EQUAL((int)(edge_pool->total_used / edge_pool->block_size), 3, "Pool should hold 3 edges");
+    
+    // 해제된 간선 슬롯은 다음 할당에서 재사용됨
+    edge_t* removed = first->vertices[0].edges;
+    graph_remove_edge(first, 0, 1);
+    graph_add_edge(first, 2, 1);
+    ASSERT_TRUE(first->vertices[2].edges == removed, "Freed edge slot should be reused");
+    
+    // 외부 풀을 쓰는 그래프는 간선만 반납하고 풀은 남겨 둠
+    graph_destroy(first);
+    ASSERT_EQUAL((int)(edge_pool->total_used / edge_pool->block_size), 1,
+                 "Only the second graph's edge should remain");
+    ASSERT_TRUE(graph_has_edge(second, 2, 0), "Second graph should be intact");
+    graph_destroy(second);
+    ASSERT_EQUAL((int)edge_pool->total_used, 0, "All edges should be returned");
+    
+    memory_pool_destroy(edge_pool);
+    TEST_END();
+}
+
+// 정점 범위 일괄 추가 테스트
+static void test_graph_add_vertices() {
+    TEST_START("Adding a range of vertices");
+    
+    graph_t* graph = graph_create(2);
+    ASSERT_EQUAL(graph_add_vertex(graph), 0, "First vertex should have id 0");
+    ASSERT_EQUAL(graph_add_vertices(graph, 1000), 1, "Range should start after existing vertices");
+    ASSERT_EQUAL(graph_get_vertex_count(graph), 1001, "Graph should have 1001 vertices");
+    ASSERT_EQUAL(graph->vertices[500].id, 500, "Vertices should be initialised with their ids");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 1000), 0, "New vertices should have no edges");
+    ASSERT_EQUAL(graph_add_vertices(graph, -1), -1, "Negative count should fail");
+    ASSERT_EQUAL(graph_add_vertices(graph, 0), 1001, "Empty range should return the next id");
+    
+    // 정점 배열이 재할당되어도 간선 인덱스는 유효해야 함
+    for (int i = 1; i <= 100; i++) {
+        graph_add_edge(graph, 0, i);
+    }
+    graph_add_vertices(graph, 5000);
+    ASSERT_EQUAL(graph_remove_edge(graph, 0, 100), SCC_SUCCESS, "Head edge removal should survive a resize");
+    ASSERT_FALSE(graph_has_edge(graph, 0, 100), "Removed edge should be gone");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 0), 99, "Hub should keep 99 edges");
+    
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 고차수 정점의 해시 인덱스 테스트
+static void test_graph_hub_edge_index() {
+    TEST_START("Hash-indexed edges on a high-degree vertex");
+    
+    const int num_vertices = 2000;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_edge(graph, 0, i);
+    }
+    ASSERT_NOT_NULL(graph->vertices[0].edge_index, "Hub vertex should be indexed");
+    ASSERT_EQUAL(graph_add_edge(graph, 0, 7), SCC_ERROR_EDGE_EXISTS, "Duplicate edge should be rejected");
+    
+    // 짝수 간선 제거 후 조회와 리스트가 일치해야 함
+    for (int i = 0; i < num_vertices; i += 2) {
+        ASSERT_EQUAL(graph_remove_edge(graph, 0, i), SCC_SUCCESS, "Edge removal should succeed");
+    }
+    ASSERT_EQUAL(graph_remove_edge(graph, 0, 4), SCC_ERROR_INVALID_PARAMETER, "Removed edge should be gone");
+    ASSERT_TRUE(graph_has_edge(graph, 0, 1) && !graph_has_edge(graph, 0, 2), "Lookups should follow removals");
+    
+    int listed = 0;
+    bool all_odd = true;
+    for (edge_t* edge = graph->vertices[0].edges; edge; edge = edge->next) {
+        if (edge->dest % 2 == 0) all_odd = false;
+        listed++;
+    }
+    ASSERT_EQUAL(listed, num_vertices / 2, "Edge list should hold the remaining edges");
+    ASSERT_TRUE(all_odd, "Only odd destinations should remain");
+    
+    // 차수가 낮아지면 인덱스를 해제하고 리스트 검색으로 돌아감
+    for (int i = 1; i < num_vertices; i += 2) {
+        graph_remove_edge(graph, 0, i);
+    }
+    ASSERT_NULL(graph->vertices[0].edge_index, "Index should be dropped for low degree");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 0), 0, "Hub should have no edges left");
+    
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 일괄 간선 추가 테스트
+static void test_graph_add_edges_bulk() {
+    TEST_START("Bulk edge insertion");
+    
+    graph_t* graph = graph_create(4);
+    for (int i = 0; i < 4; i++) {
+        graph_add_vertex(graph);
+    }
+    graph_add_edge(graph, 0, 1);
+    
+    // 0->1은 이미 있고 2->3은 배치 안에서 중복
+    int src[] = {0, 1, 2, 2, 3, 0};
+    int dst[] = {1, 2, 3, 3, 0, 2};
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, src, dst, 6, 0), 4, "4 new edges should be added");
+    ASSERT_EQUAL(graph_get_edge_count(graph), 5, "Graph should have 5 edges");
+    ASSERT_TRUE(graph_has_edge(graph, 3, 0) && graph_has_edge(graph, 0, 2), "Bulk edges should exist");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 2), 1, "Duplicate in the batch should be skipped");
+    
+    // 잘못된 정점이 하나라도 있으면 아무것도 추가하지 않음
+    int bad_src[] = {1, 7};
+    int bad_dst[] = {3, 0};
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, bad_src, bad_dst, 2, 0), SCC_ERROR_INVALID_VERTEX,
+                 "Invalid vertex should reject the batch");
+    ASSERT_FALSE(graph_has_edge(graph, 1, 3), "Rejected batch should add nothing");
+    
+    int unique_src[] = {1, 3};
+    int unique_dst[] = {3, 1};
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, unique_src, unique_dst, 2, GRAPH_BULK_ASSUME_UNIQUE), 2,
+                 "Unique batch should be added without dedup");
+    ASSERT_EQUAL(graph_get_edge_count(graph), 7, "Graph should have 7 edges");
+    
+    graph_destroy(graph);
+    
+    // 중복 검사 없이 고차수가 된 정점도 이후 배치에서는 중복을 걸러야 함
+    graph = graph_create(100);
+    graph_add_vertices(graph, 100);
+    int wide_src[64], wide_dst[64];
+    for (int i = 0; i < 64; i++) {
+        wide_src[i] = 5;
+        wide_dst[i] = i;
+    }
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, wide_src, wide_dst, 40, GRAPH_BULK_ASSUME_UNIQUE), 40,
+                 "Unique wide batch should be added");
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, wide_src, wide_dst, 64, 0), 24,
+                 "Only edges missing from a high-degree vertex should be added");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 5), 64, "High-degree vertex should have no duplicates");
+    graph_destroy(graph);
+    
+    // 스크래치는 배치 크기에 비례: 큰 그래프에 작은 배치를 넣어도 정점 수만큼 할당하지 않음
+    const int large = 1000000;
+    graph = graph_create(large);
+    graph_add_vertices(graph, large);
+    int small_src[] = {large - 1, 0, large - 1, 12345};
+    int small_dst[] = {0, large - 1, 0, 54321};
+    size_t baseline = scc_memory_current_bytes();
+    scc_memory_reset_peak();
+    ASSERT_EQUAL(graph_add_edges_bulk(graph, small_src, small_dst, 4, 0), 3, "Small batch should dedup");
+    ASSERT_TRUE(scc_memory_peak_bytes() - baseline < (size_t)large, "Small batch scratch should not scale with V");
+    graph_destroy(graph);
+    TEST_END();
+}
+
+static bool same_csr(const csr_graph_t* a, const csr_graph_t* b) {
+    return a->num_vertices == b->num_vertices && a->num_edges == b->num_edges &&
+           memcmp(a->offsets, b->offsets, ((size_t)a->num_vertices + 1) * sizeof(int64_t)) == 0 &&
+           memcmp(a->targets, b->targets, (size_t)a->num_edges * sizeof(int)) == 0;
+}
+
+static void test_graph_generators() {
+    TEST_START("Synthetic graph generators");
+    
+    // 같은 시드면 스레드 수와 관계없이 같은 그래프
+    csr_graph_t* a = csr_graph_generate_erdos_renyi(1000, 8000, 42, 1);
+    csr_graph_t* b = csr_graph_generate_erdos_renyi(1000, 8000, 42, 4);
+    ASSERT_NOT_NULL(a, "Erdos-Renyi generation should succeed");
+    ASSERT_TRUE(same_csr(a, b), "Same seed should give the same graph for any thread count");
+    ASSERT_TRUE(a->num_edges > 7900 && a->num_edges <= 8000, "Only duplicate draws should be dropped");
+    bool self_loop = false;
+    for (int v = 0; v < a->num_vertices; v++) {
+        for (int64_t e = a->offsets[v]; e < a->offsets[v + 1]; e++) {
+            if (a->targets[e] == v) self_loop = true;
+        }
+    }
+    ASSERT_FALSE(self_loop, "Erdos-Renyi graph should have no self-loops");
+    csr_graph_destroy(b);
+    
+    b = csr_graph_generate_erdos_renyi(1000, 8000, 43, 1);
+    ASSERT_FALSE(same_csr(a, b), "Different seeds should give different graphs");
+    csr_graph_destroy(a);
+    csr_graph_destroy(b);
+    
+    a = csr_graph_generate_rmat(10, 16384, 0.57, 0.19, 0.19, 7, 1);
+    b = csr_graph_generate_rmat(10, 16384, 0.57, 0.19, 0.19, 7, 3);
+    ASSERT_NOT_NULL(a, "R-MAT generation should succeed");
+    ASSERT_EQUAL(a->num_vertices, 1024, "R-MAT should have 2^scale vertices");
+    ASSERT_TRUE(same_csr(a, b), "R-MAT should be deterministic per seed");
+    csr_graph_destroy(a);
+    csr_graph_destroy(b);
+    
+    graph_t* graph = graph_generate_barabasi_albert(2000, 4, 3);
+    ASSERT_NOT_NULL(graph, "Barabasi-Albert generation should succeed");
+    ASSERT_TRUE(graph_is_valid(graph), "Generated graph should be valid");
+    scc_result_t* result = scc_find_tarjan(graph);
+    ASSERT_TRUE(result->largest_component_size > 1000, "Random orientation should give a giant SCC");
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    
+    ASSERT_NULL(csr_graph_generate_rmat(31, 10, 0.57, 0.19, 0.19, 1, 0), "Scale above 30 should be rejected");
+    ASSERT_NULL(csr_graph_generate_rmat(4, 10, 0.6, 0.3, 0.2, 1, 0), "Probabilities above 1 should be rejected");
+    ASSERT_NULL(csr_graph_generate_erdos_renyi(1, 5, 1, 0), "Edges need at least two vertices");
+    
+    TEST_END();
+}
+
+static void test_graph_planted_scc() {
+    TEST_START("Planted SCC generator ground truth");
+    
+    scc_result_t* truth = NULL;
+    csr_graph_t* csr = csr_graph_generate_planted_scc(300, 1, 20, 5, 11, 0, &truth);
+    ASSERT_NOT_NULL(csr, "Planted SCC generation should succeed");
+    ASSERT_NOT_NULL(truth, "Ground truth should be returned");
+    ASSERT_EQUAL(truth->num_components, 300, "Ground truth should have 300 components");
+    ASSERT_EQUAL(truth->num_vertices, csr->num_vertices, "Ground truth should cover every vertex");
+    
+    // 발견된 SCC 수와 각 정점의 짝이 심은 분할과 같아야 함
+    scc_result_t* result = scc_find_tarjan_csr(csr);
+    ASSERT_EQUAL(result->num_components, truth->num_components, "Tarjan should find the planted components");
+    int* match = malloc((size_t)truth->num_components * sizeof(int));
+    for (int c = 0; c < truth->num_components; c++) match[c] = -1;
+    bool same = true;
+    bool topological = true;
+    for (int v = 0; v < csr->num_vertices; v++) {
+        int planted = truth->vertex_to_component[v];
+        if (match[planted] == -1) match[planted] = result->vertex_to_component[v];
+        else if (match[planted] != result->vertex_to_component[v]) same = false;
+        for (int64_t e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            if (planted > truth->vertex_to_component[csr->targets[e]]) topological = false;
+        }
+    }
+    ASSERT_TRUE(same, "Tarjan should find exactly the planted partition");
+    ASSERT_TRUE(topological, "Planted numbering should be topological");
+    free(match);
+    
+    scc_result_destroy(result);
+    scc_result_destroy(truth);
+    csr_graph_destroy(csr);
+    TEST_END();
+}
+
 // 모든 그래프 테스트 실행
 void run_graph_tests() {
     printf("=== 그래프 모듈 테스트 ===\n");
@@ -214,6 +514,13 @@ void run_graph_tests() {
     test_graph_transpose();
     test_graph_validation();
     test_graph_copy();
+    test_graph_freeze();
+    test_graph_memory_pools();
+    test_graph_add_vertices();
+    test_graph_hub_edge_index();
+    test_graph_add_edges_bulk();
+    test_graph_generators();
+    test_graph_planted_scc();
     
     printf("그래프 모듈 테스트 완료\n\n");
 }
\ No newline at end of file
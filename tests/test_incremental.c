@@ -0,0 +1,145 @@
+#include "test_framework.h"
+#include "../src/scc_algorithms.h"
+#include "../src/graph.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 컴포넌트 사이의 모든 간선이 번호가 증가하는 방향인지 확인
+static bool is_topological(const graph_t* graph, const scc_result_t* result) {
+    for (int v = 0; v < graph->num_vertices; v++) {
+        for (edge_t* edge = graph->vertices[v].edges; edge; edge = edge->next) {
+            if (result->vertex_to_component[v] > result->vertex_to_component[edge->dest]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 사이클을 닫는 간선만 병합을 일으켜야 함
+static void test_incremental_basic() {
+    TEST_START("Incremental SCC basic insertion");
+
+    scc_incremental_t* inc = scc_incremental_create(4);
+    ASSERT_NOT_NULL(inc, "증분 SCC 생성이 성공해야 함");
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQUAL(scc_incremental_add_vertex(inc), i, "정점 번호가 순서대로 부여되어야 함");
+    }
+
+    const scc_result_t* result = scc_incremental_get_result(inc);
+    ASSERT_NOT_NULL(result, "결과를 얻을 수 있어야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 5, "간선이 없으면 5개의 SCC");
+    ASSERT_FALSE(scc_incremental_needs_update(inc), "결과 생성 후에는 최신 상태여야 함");
+
+    // 경로 4 -> 3 -> 2 -> 1 -> 0 : 초기 순서를 거스르지만 사이클은 없음
+    for (int i = 4; i > 0; i--) {
+        ASSERT_EQUAL(scc_incremental_add_edge(inc, i, i - 1), SCC_SUCCESS, "간선 추가가 성공해야 함");
+    }
+    ASSERT_FALSE(scc_incremental_needs_update(inc), "사이클이 없으면 결과가 유지되어야 함");
+    ASSERT_TRUE(scc_incremental_get_result(inc) == result, "같은 결과 객체가 반환되어야 함");
+
+    // 0 -> 2 는 {0, 1, 2} 사이클을 닫음
+    ASSERT_EQUAL(scc_incremental_add_edge(inc, 0, 2), SCC_SUCCESS, "간선 추가가 성공해야 함");
+    ASSERT_TRUE(scc_incremental_needs_update(inc), "병합 후에는 갱신이 필요해야 함");
+
+    result = scc_incremental_get_result(inc);
+    ASSERT_EQUAL(scc_get_component_count(result), 3, "3개의 SCC가 있어야 함");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 0), scc_get_vertex_component(result, 2),
+                 "정점 0과 2는 같은 SCC");
+    ASSERT_TRUE(is_topological(inc->graph, result), "컴포넌트 번호가 위상 순서여야 함");
+
+    ASSERT_EQUAL(scc_incremental_add_edge(inc, 0, 2), SCC_ERROR_EDGE_EXISTS, "중복 간선은 거부되어야 함");
+    ASSERT_EQUAL(scc_incremental_add_edge(inc, 0, 9), SCC_ERROR_INVALID_VERTEX, "잘못된 정점은 거부되어야 함");
+
+    scc_incremental_destroy(inc);
+    TEST_END();
+}
+
+// 컴포넌트 내부 간선 삭제는 그 컴포넌트만 쪼개야 함
+static void test_incremental_split() {
+    TEST_START("Incremental SCC split on edge removal");
+
+    scc_incremental_t* inc = scc_incremental_create(8);
+    for (int i = 0; i < 8; i++) {
+        scc_incremental_add_vertex(inc);
+    }
+
+    // 사이클 {0,1,2}와 {3,4,5}를 2 <-> 3으로 묶고, 6 -> 0, 5 -> 7은 바깥 간선
+    int edges[][2] = { {0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3},
+                       {2, 3}, {3, 2}, {6, 0}, {5, 7} };
+    for (int i = 0; i < 10; i++) {
+        scc_incremental_add_edge(inc, edges[i][0], edges[i][1]);
+    }
+
+    const scc_result_t* result = scc_incremental_get_result(inc);
+    ASSERT_EQUAL(scc_get_component_count(result), 3, "3개의 SCC가 있어야 함");
+
+    // 바깥 간선 삭제는 분할을 바꾸지 않음
+    ASSERT_EQUAL(scc_incremental_remove_edge(inc, 6, 0), SCC_SUCCESS, "간선 삭제가 성공해야 함");
+    ASSERT_FALSE(scc_incremental_needs_update(inc), "바깥 간선 삭제 후에도 결과가 유지되어야 함");
+
+    // 사이클을 잇는 간선 삭제는 큰 컴포넌트를 둘로 쪼갬
+    ASSERT_EQUAL(scc_incremental_remove_edge(inc, 3, 2), SCC_SUCCESS, "간선 삭제가 성공해야 함");
+    result = scc_incremental_get_result(inc);
+    ASSERT_EQUAL(scc_get_component_count(result), 4, "4개의 SCC가 있어야 함");
+    ASSERT_TRUE(scc_get_vertex_component(result, 0) != scc_get_vertex_component(result, 3),
+                "정점 0과 3은 다른 SCC");
+    ASSERT_TRUE(is_topological(inc->graph, result), "컴포넌트 번호가 위상 순서여야 함");
+
+    ASSERT_EQUAL(scc_incremental_remove_edge(inc, 3, 2), SCC_ERROR_INVALID_PARAMETER,
+                 "없는 간선 삭제는 실패해야 함");
+
+    scc_incremental_destroy(inc);
+    TEST_END();
+}
+
+// 무작위 삽입/삭제 후 매번 Tarjan과 같은 분할인지 확인
+static void test_incremental_vs_tarjan() {
+    TEST_START("Incremental SCC vs Tarjan on random updates");
+
+    const int num_vertices = 300;
+    scc_incremental_t* inc = scc_incremental_create(0);
+    for (int i = 0; i < num_vertices; i++) {
+        scc_incremental_add_vertex(inc);
+    }
+
+    srand(11);
+    bool all_match = true;
+    for (int step = 0; step < 1500 && all_match; step++) {
+        int src = rand() % num_vertices;
+        int dest = rand() % num_vertices;
+        if (step % 10 == 9) {
+            scc_incremental_remove_edge(inc, src, dest);
+        } else {
+            scc_incremental_add_edge(inc, src, dest);
+        }
+
+        if (step % 25 == 0) {
+            const scc_result_t* result = scc_incremental_get_result(inc);
+            scc_result_t* expected = scc_find_tarjan(inc->graph);
+            all_match = scc_result_equivalent(result, expected);
+            scc_result_destroy(expected);
+        }
+    }
+    ASSERT_TRUE(all_match, "Tarjan과 같은 분할이어야 함");
+
+    inc->preferred_algorithm = SCC_INCREMENTAL_KOSARAJU;
+    scc_incremental_force_recompute(inc);
+    ASSERT_FALSE(scc_incremental_needs_update(inc), "재계산 후에는 최신 상태여야 함");
+    ASSERT_TRUE(is_topological(inc->graph, scc_incremental_get_result(inc)),
+                "재계산 후에도 위상 순서여야 함");
+
+    scc_incremental_destroy(inc);
+    TEST_END();
+}
+
+// 모든 증분 SCC 테스트 실행
+void run_incremental_tests() {
+    printf("=== 증분 SCC 유지 테스트 ===\n");
+
+    test_incremental_basic();
+    test_incremental_split();
+    test_incremental_vs_tarjan();
+
+    printf("증분 SCC 유지 테스트 완료\n\n");
+}
@@ -336,6 +336,364 @@ static void test_large_graph_io() {
     TEST_END();
 }
 
+// 메모리 매핑 CSR 로더 테스트
+static void test_csr_edge_list_loader() {
+    TEST_START("Memory-mapped CSR edge list loader");
+    
+    char* filename = get_temp_filename("csr_edges.txt");
+    FILE* file = fopen(filename, "w");
+    ASSERT_NOT_NULL(file, "테스트 파일 생성이 성공해야 함");
+    
+    // 주석, 빈 줄, CRLF, 중복 간선, 뒤따르는 내용, 마지막 줄의 개행 누락
+    fprintf(file, "# header\n");
+    fprintf(file, "0 3\n");
+    fprintf(file, "\n");
+    fprintf(file, "0 1\r\n");
+    fprintf(file, "  2\t0   weight=5\n");
+    fprintf(file, "0 3\n");
+    fprintf(file, "7\n");
+    fprintf(file, "1 2");
+    fclose(file);
+    
+    csr_graph_t* csr = csr_graph_load_edge_list(filename, 0);
+    ASSERT_NOT_NULL(csr, "CSR 로드가 성공해야 함");
+    ASSERT_EQUAL(csr->num_vertices, 4, "정점 수가 4개여야 함");
+    ASSERT_EQUAL((int)csr->num_edges, 4, "중복을 뺀 간선 수가 4개여야 함");
+    ASSERT_EQUAL(csr_graph_get_out_degree(csr, 0), 2, "정점 0의 차수가 2여야 함");
+    ASSERT_EQUAL(csr->targets[csr->offsets[0]], 1, "이웃은 오름차순이어야 함");
+    ASSERT_EQUAL(csr->targets[csr->offsets[0] + 1], 3, "이웃은 오름차순이어야 함");
+    ASSERT_EQUAL(csr->targets[csr->offsets[1]], 2, "마지막 줄의 간선 1->2가 있어야 함");
+    
+    graph_t* graph = graph_from_csr(csr);
+    ASSERT_NOT_NULL(graph, "CSR에서 그래프 생성이 성공해야 함");
+    ASSERT_EQUAL(graph_get_edge_count(graph), 4, "그래프 간선 수가 같아야 함");
+    ASSERT_TRUE(graph_has_edge(graph, 2, 0), "간선 2->0이 있어야 함");
+    graph_destroy(graph);
+    csr_graph_destroy(csr);
+    
+    // 음수 정점 번호는 거부
+    file = fopen(filename, "w");
+    fprintf(file, "0 1\n1 -2\n");
+    fclose(file);
+    ASSERT_NULL(csr_graph_load_edge_list(filename, 0), "음수 정점은 실패해야 함");
+    ASSERT_EQUAL(scc_get_last_error(), SCC_ERROR_INVALID_VERTEX, "INVALID_VERTEX 오류여야 함");
+    
+    ASSERT_NULL(csr_graph_load_edge_list("nonexistent_file.txt", 0), "존재하지 않는 파일은 실패해야 함");
+    
+    remove(filename);
+    TEST_END();
+}
+
+// 바이너리 CSR 형식 저장 및 매핑 테스트
+static void test_binary_format() {
+    TEST_START("Binary CSR format round trip");
+    
+    graph_t* graph = graph_create(6);
+    for (int i = 0; i < 6; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    // SCC: {0,1,2}, {3,4}, {5}
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 3);
+    graph_add_edge(graph, 4, 5);
+    
+    char* filename = get_temp_filename("graph.bin");
+    ASSERT_EQUAL(graph_save_to_file(graph, filename, GRAPH_FORMAT_BINARY), SCC_SUCCESS,
+                 "바이너리 저장이 성공해야 함");
+    
+    // 매핑한 CSR은 graph_freeze 결과와 같아야 함
+    csr_graph_t* expected = graph_freeze(graph);
+    csr_graph_t* csr = csr_graph_map_binary(filename);
+    ASSERT_NOT_NULL(csr, "바이너리 매핑이 성공해야 함");
+    ASSERT_EQUAL(csr->num_vertices, 6, "정점 수가 같아야 함");
+    ASSERT_EQUAL((int)csr->num_edges, 7, "간선 수가 같아야 함");
+    ASSERT_TRUE(memcmp(csr->offsets, expected->offsets, 7 * sizeof(int64_t)) == 0, "오프셋이 같아야 함");
+    ASSERT_TRUE(memcmp(csr->targets, expected->targets, 7 * sizeof(int)) == 0, "간선 대상이 같아야 함");
+    
+    scc_result_t* result = scc_find_tarjan_csr(csr);
+    ASSERT_NOT_NULL(result, "매핑된 CSR에서 SCC 찾기가 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 3, "3개의 SCC가 있어야 함");
+    scc_result_destroy(result);
+    csr_graph_destroy(csr);
+    csr_graph_destroy(expected);
+    
+    graph_t* loaded = NULL;
+    ASSERT_EQUAL(graph_load_from_file(&loaded, filename, GRAPH_FORMAT_BINARY), SCC_SUCCESS,
+                 "바이너리 로드가 성공해야 함");
+    ASSERT_NOT_NULL(loaded, "로드된 그래프가 있어야 함");
+    ASSERT_EQUAL(graph_get_edge_count(loaded), 7, "간선 수가 같아야 함");
+    ASSERT_TRUE(graph_has_edge(loaded, 4, 5), "간선 4->5가 있어야 함");
+    graph_destroy(loaded);
+    
+    // 구획 위치/크기 계산이 넘치도록 조작한 헤더는 거부
+    // (헤더 배치: num_vertices@24, num_edges@32, offsets_pos@40)
+    int64_t num_vertices = 1023;
+    uint64_t offsets_pos = UINT64_MAX - 4095;  // + 1024 * 8 이면 4096으로 넘침
+    FILE* file = fopen(filename, "r+b");
+    fseek(file, 24, SEEK_SET);
+    fwrite(&num_vertices, sizeof(num_vertices), 1, file);
+    fseek(file, 40, SEEK_SET);
+    fwrite(&offsets_pos, sizeof(offsets_pos), 1, file);
+    fclose(file);
+    ASSERT_NULL(csr_graph_map_binary(filename), "넘치는 오프셋 위치는 실패해야 함");
+    
+    ASSERT_EQUAL(graph_save_to_file(graph, filename, GRAPH_FORMAT_BINARY), SCC_SUCCESS,
+                 "바이너리 저장이 성공해야 함");
+    int64_t num_edges = ((int64_t)1 << 62) + 7;  // * sizeof(int) 이면 28로 넘침
+    file = fopen(filename, "r+b");
+    fseek(file, 32, SEEK_SET);
+    fwrite(&num_edges, sizeof(num_edges), 1, file);
+    fclose(file);
+    ASSERT_NULL(csr_graph_map_binary(filename), "넘치는 간선 수는 실패해야 함");
+    
+    // 잘못된 매직 넘버와 잘린 파일은 거부
+    file = fopen(filename, "r+b");
+    fputc('X', file);
+    fclose(file);
+    ASSERT_NULL(csr_graph_map_binary(filename), "잘못된 매직 넘버는 실패해야 함");
+    ASSERT_EQUAL(scc_get_last_error(), SCC_ERROR_INVALID_PARAMETER, "INVALID_PARAMETER 오류여야 함");
+    
+    file = fopen(filename, "w");
+    fprintf(file, "0 1\n");
+    fclose(file);
+    ASSERT_NULL(csr_graph_map_binary(filename), "텍스트 파일은 실패해야 함");
+    ASSERT_NULL(csr_graph_map_binary("nonexistent_file.bin"), "존재하지 않는 파일은 실패해야 함");
+    
+    remove(filename);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 되감기 없는 스트림 로더 테스트 (읽기 블록 경계와 블록보다 긴 줄 포함)
+static void test_stream_loading() {
+    TEST_START("Single-pass stream loading");
+    
+    const int num_vertices = 200000;
+    FILE* stream = tmpfile();
+    ASSERT_NOT_NULL(stream, "임시 스트림 생성이 성공해야 함");
+    
+    // 하나의 큰 사이클, 중간에 읽기 블록보다 긴 주석 줄
+    for (int i = 0; i < num_vertices; i++) {
+        fprintf(stream, "%d %d\n", i, (i + 1) % num_vertices);
+        if (i == num_vertices / 2) {
+            fputc('#', stream);
+            for (int j = 0; j < (3 << 20); j++) fputc('x', stream);
+            fputc('\n', stream);
+        }
+    }
+    fprintf(stream, "0 1\n");
+    rewind(stream);
+    
+    graph_t* graph = NULL;
+    ASSERT_EQUAL(graph_load_from_stream(&graph, stream, GRAPH_FORMAT_EDGE_LIST), SCC_SUCCESS,
+                 "간선 리스트 스트림 로드가 성공해야 함");
+    ASSERT_EQUAL(graph_get_vertex_count(graph), num_vertices, "정점 수가 같아야 함");
+    ASSERT_EQUAL(graph_get_edge_count(graph), num_vertices, "중복을 뺀 간선 수가 같아야 함");
+    ASSERT_TRUE(graph_has_edge(graph, num_vertices / 2, num_vertices / 2 + 1), "긴 줄 뒤의 간선이 있어야 함");
+    
+    scc_result_t* result = scc_find_tarjan(graph);
+    ASSERT_EQUAL(scc_get_component_count(result), 1, "하나의 SCC여야 함");
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    fclose(stream);
+    
+    // 인접 리스트도 한 번에 읽으며 정점 수를 늘림
+    stream = tmpfile();
+    fprintf(stream, "# adjacency\n0 1 2\n2 0\n9\n1 2 2\n");
+    rewind(stream);
+    ASSERT_EQUAL(graph_load_from_stream(&graph, stream, GRAPH_FORMAT_ADJACENCY_LIST), SCC_SUCCESS,
+                 "인접 리스트 스트림 로드가 성공해야 함");
+    ASSERT_EQUAL(graph_get_vertex_count(graph), 10, "가장 큰 번호까지 정점이 있어야 함");
+    ASSERT_EQUAL(graph_get_edge_count(graph), 4, "중복을 뺀 간선 수가 4개여야 함");
+    graph_destroy(graph);
+    
+    rewind(stream);
+    ASSERT_EQUAL(graph_load_from_stream(&graph, stream, GRAPH_FORMAT_DOT), SCC_ERROR_INVALID_PARAMETER,
+                 "지원하지 않는 형식은 실패해야 함");
+    ASSERT_NULL(graph, "실패하면 그래프가 NULL이어야 함");
+    fclose(stream);
+    
+    ASSERT_EQUAL(graph_load_from_stream(&graph, NULL, GRAPH_FORMAT_EDGE_LIST), SCC_ERROR_NULL_POINTER,
+                 "NULL 스트림은 실패해야 함");
+    
+    TEST_END();
+}
+
+// 희소한 64비트 외부 ID 재매핑 로더 테스트
+static void test_remap_loader() {
+    TEST_START("Sparse 64-bit vertex ID remapping");
+    
+    char* filename = get_temp_filename("remap_edges.txt");
+    FILE* file = fopen(filename, "w");
+    ASSERT_NOT_NULL(file, "테스트 파일 생성이 성공해야 함");
+    
+    // 사이클 {2^40 - 1, 18446744073709551615, 7}, 7 -> 123456789012, 중복 간선
+    fprintf(file, "# sparse ids\n");
+    fprintf(file, "1099511627775 18446744073709551615\n");
+    fprintf(file, "18446744073709551615 7\n");
+    fprintf(file, "7 1099511627775\n");
+    fprintf(file, "7 123456789012\n");
+    fprintf(file, "7 1099511627775\n");
+    fclose(file);
+    
+    scc_id_map_t* id_map = NULL;
+    graph_t* graph = NULL;
+    ASSERT_EQUAL(graph_load_edge_list_remap(&graph, filename, &id_map), SCC_SUCCESS,
+                 "재매핑 로드가 성공해야 함");
+    ASSERT_NOT_NULL(id_map, "ID 매핑이 반환되어야 함");
+    ASSERT_EQUAL(graph_get_vertex_count(graph), 4, "서로 다른 ID 수만큼 정점이 있어야 함");
+    ASSERT_EQUAL(graph_get_edge_count(graph), 4, "중복을 뺀 간선 수가 4개여야 함");
+    
+    // 첫 등장 순서대로 번호가 매겨짐
+    ASSERT_EQUAL(scc_id_map_find(id_map, 1099511627775ULL), 0, "첫 ID는 0번");
+    ASSERT_EQUAL(scc_id_map_find(id_map, 18446744073709551615ULL), 1, "두 번째 ID는 1번");
+    ASSERT_EQUAL(scc_id_map_find(id_map, 5), -1, "없는 ID는 -1");
+    ASSERT_TRUE(scc_id_map_external(id_map, 3) == 123456789012ULL, "역방향 매핑이 외부 ID를 돌려줘야 함");
+    ASSERT_TRUE(graph_has_edge(graph, scc_id_map_find(id_map, 7), scc_id_map_find(id_map, 123456789012ULL)),
+                "간선 7 -> 123456789012가 있어야 함");
+    
+    scc_result_t* result = scc_find_tarjan(graph);
+    ASSERT_EQUAL(scc_get_component_count(result), 2, "2개의 SCC가 있어야 함");
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    scc_id_map_destroy(id_map);
+    
+    // 2^64 이상이나 음수는 거부
+    file = fopen(filename, "w");
+    fprintf(file, "1 18446744073709551616\n");
+    fclose(file);
+    ASSERT_EQUAL(graph_load_edge_list_remap(&graph, filename, &id_map), SCC_ERROR_INVALID_VERTEX,
+                 "범위를 넘는 ID는 실패해야 함");
+    ASSERT_NULL(id_map, "실패하면 매핑이 NULL이어야 함");
+    remove(filename);
+    
+    // 테이블 확장 후에도 모든 ID를 찾을 수 있어야 함
+    id_map = scc_id_map_create(0);
+    bool in_order = true;
+    for (int i = 0; i < 100000; i++) {
+        if (scc_id_map_get_or_add(id_map, (uint64_t)i << 24) != i) in_order = false;
+    }
+    ASSERT_TRUE(in_order, "새 ID는 순서대로 번호를 받아야 함");
+    
+    bool all_found = true;
+    for (int i = 0; i < 100000 && all_found; i++) {
+        all_found = scc_id_map_find(id_map, (uint64_t)i << 24) == i &&
+                    scc_id_map_external(id_map, i) == (uint64_t)i << 24;
+    }
+    ASSERT_TRUE(all_found, "확장 후에도 양방향 매핑이 유지되어야 함");
+    ASSERT_EQUAL(scc_id_map_get_or_add(id_map, 0), 0, "기존 ID는 같은 번호를 돌려줘야 함");
+    ASSERT_EQUAL(scc_id_map_count(id_map), 100000, "ID 수가 같아야 함");
+    scc_id_map_destroy(id_map);
+    
+    TEST_END();
+}
+
+// 줄 길이와 이웃 수 제한이 없는 인접 리스트 로더 테스트
+static void test_adjacency_list_long_lines() {
+    TEST_START("Adjacency list without line or degree limits");
+    
+    const int degree = 50000;
+    char* filename = get_temp_filename("adjacency_hub.txt");
+    FILE* file = fopen(filename, "w");
+    ASSERT_NOT_NULL(file, "테스트 파일 생성이 성공해야 함");
+    
+    // 읽기 블록 여러 개에 걸치는 허브 줄, 정수가 아닌 토큰, 개행 없는 마지막 줄
+    fprintf(file, "  # comment\n");
+    fprintf(file, "0");
+    for (int i = 1; i <= degree; i++) {
+        fprintf(file, " %d", i);
+    }
+    fprintf(file, "\r\n");
+    fprintf(file, "label 5 x7 0\n");
+    fprintf(file, "%d\t0", degree);
+    fclose(file);
+    
+    graph_t* graph = NULL;
+    ASSERT_EQUAL(graph_load_from_file(&graph, filename, GRAPH_FORMAT_ADJACENCY_LIST), SCC_SUCCESS,
+                 "인접 리스트 로드가 성공해야 함");
+    ASSERT_EQUAL(graph_get_vertex_count(graph), degree + 1, "정점 수가 같아야 함");
+    ASSERT_EQUAL(graph_get_out_degree(graph, 0), degree, "허브의 이웃이 잘리지 않아야 함");
+    ASSERT_TRUE(graph_has_edge(graph, 0, degree), "허브의 마지막 이웃이 있어야 함");
+    ASSERT_TRUE(graph_has_edge(graph, 5, 0), "정수가 아닌 토큰은 건너뛰어야 함");
+    ASSERT_FALSE(graph_has_edge(graph, 5, 7), "x7은 정점이 아님");
+    ASSERT_TRUE(graph_has_edge(graph, degree, 0), "개행 없는 마지막 줄도 읽어야 함");
+    ASSERT_EQUAL(graph_get_edge_count(graph), degree + 2, "간선 수가 같아야 함");
+    graph_destroy(graph);
+    
+    // 음수와 int 범위를 넘는 번호는 거부
+    file = fopen(filename, "w");
+    fprintf(file, "0 1 -2\n");
+    fclose(file);
+    ASSERT_EQUAL(graph_load_from_file(&graph, filename, GRAPH_FORMAT_ADJACENCY_LIST), SCC_ERROR_INVALID_VERTEX,
+                 "음수 정점은 실패해야 함");
+    ASSERT_NULL(graph, "실패하면 그래프가 NULL이어야 함");
+    
+    file = fopen(filename, "w");
+    fprintf(file, "0 4294967296\n");
+    fclose(file);
+    ASSERT_EQUAL(graph_load_from_file(&graph, filename, GRAPH_FORMAT_ADJACENCY_LIST), SCC_ERROR_INVALID_VERTEX,
+                 "int 범위를 넘는 정점은 실패해야 함");
+    
+    file = fopen(filename, "w");
+    fprintf(file, "0 2147483647\n");
+    fclose(file);
+    ASSERT_EQUAL(graph_load_from_file(&graph, filename, GRAPH_FORMAT_ADJACENCY_LIST), SCC_ERROR_INVALID_VERTEX,
+                 "INT_MAX 정점은 정점 수가 넘치므로 실패해야 함");
+    ASSERT_NULL(graph, "실패하면 그래프가 NULL이어야 함");
+    
+    remove(filename);
+    TEST_END();
+}
+
+// 버퍼 기반 텍스트 저장의 정수 변환 테스트 (자릿수 경계)
+static void test_buffered_writers() {
+    TEST_START("Buffered text writers");
+    
+    const int num_vertices = 1000001;
+    const int sources[] = { 0, 9, 10, 99, 100, 999, 9999, 99999, 999999 };
+    graph_t* graph = graph_create(num_vertices);
+    graph_add_vertices(graph, num_vertices);
+    for (int i = 0; i < 9; i++) {
+        graph_add_edge(graph, sources[i], sources[i] + 1);
+    }
+    
+    char* filename = get_temp_filename("writer.txt");
+    graph_format_t formats[] = { GRAPH_FORMAT_EDGE_LIST, GRAPH_FORMAT_ADJACENCY_LIST };
+    for (int f = 0; f < 2; f++) {
+        ASSERT_EQUAL(graph_save_to_file(graph, filename, formats[f]), SCC_SUCCESS, "저장이 성공해야 함");
+        
+        graph_t* loaded = NULL;
+        ASSERT_EQUAL(graph_load_from_file(&loaded, filename, formats[f]), SCC_SUCCESS, "다시 로드가 성공해야 함");
+        ASSERT_EQUAL(graph_get_edge_count(loaded), 9, "간선 수가 같아야 함");
+        for (int i = 0; i < 9; i++) {
+            ASSERT_TRUE(graph_has_edge(loaded, sources[i], sources[i] + 1), "자릿수가 바뀌는 간선도 그대로여야 함");
+        }
+        graph_destroy(loaded);
+    }
+    
+    // DOT 줄 형식은 fprintf 시절과 같아야 함
+    ASSERT_EQUAL(graph_save_to_file(graph, filename, GRAPH_FORMAT_DOT), SCC_SUCCESS, "DOT 저장이 성공해야 함");
+    FILE* file = fopen(filename, "r");
+    char line[256];
+    bool found_label = false, found_edge = false;
+    while (fgets(line, sizeof(line), file)) {
+        if (strcmp(line, "  1000000 [label=\"1000000\"];\n") == 0) found_label = true;
+        if (strcmp(line, "  999 -> 1000;\n") == 0) found_edge = true;
+    }
+    fclose(file);
+    ASSERT_TRUE(found_label, "정점 정의 줄이 있어야 함");
+    ASSERT_TRUE(found_edge, "간선 정의 줄이 있어야 함");
+    
+    remove(filename);
+    graph_destroy(graph);
+    TEST_END();
+}
+
 // 모든 I/O 테스트 실행
 void run_io_tests() {
     printf("=== I/O 모듈 테스트 ===\n");
@@ -348,6 +706,12 @@ void run_io_tests() {
     test_file_error_handling();
     test_invalid_format_handling();
     test_large_graph_io();
+    test_csr_edge_list_loader();
+    test_binary_format();
+    test_stream_loading();
+    test_remap_loader();
+    test_adjacency_list_long_lines();
+    test_buffered_writers();
     
     printf("I/O 모듈 테스트 완료\n\n");
 }
\ No newline at end of file
@@ -140,6 +140,16 @@ static void test_kosaraju_transpose() {
     ASSERT_EQUAL(scc_get_component_count(result), 1, "하나의 SCC가 있어야 함");
     ASSERT_EQUAL(scc_get_component_size(result, 0), 3, "SCC 크기가 3이어야 함");
     
+    // 역방향 인접 배열 직접 확인
+    csr_graph_t* reverse = graph_transpose_csr(original);
+    ASSERT_NOT_NULL(reverse, "역방향 인접 배열 생성이 성공해야 함");
+    ASSERT_EQUAL((int)reverse->num_edges, 3, "간선 수가 같아야 함");
+    ASSERT_EQUAL(csr_graph_get_out_degree(reverse, 0), 1, "정점 0의 역방향 차수는 1이어야 함");
+    ASSERT_EQUAL(reverse->targets[reverse->offsets[0]], 2, "2->0 간선이 0->2로 뒤집혀야 함");
+    ASSERT_EQUAL(reverse->targets[reverse->offsets[1]], 0, "0->1 간선이 1->0으로 뒤집혀야 함");
+    ASSERT_EQUAL(reverse->targets[reverse->offsets[2]], 1, "1->2 간선이 2->1로 뒤집혀야 함");
+    
+    csr_graph_destroy(reverse);
     scc_result_destroy(result);
     graph_destroy(original);
     TEST_END();
@@ -298,7 +308,80 @@ static void test_kosaraju_edge_cases() {
     TEST_END();
 }
 
+// CSR 그래프에서 Kosaraju 테스트
+static void test_kosaraju_csr() {
+    TEST_START("Kosaraju algorithm on frozen CSR graph");
+    
+    graph_t* graph = graph_create(6);
+    for (int i = 0; i < 6; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 0);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 2);
+    graph_add_edge(graph, 4, 5);
+    
+    csr_graph_t* csr = graph_freeze(graph);
+    ASSERT_NOT_NULL(csr, "CSR 고정이 성공해야 함");
+    
+    scc_result_t* csr_result = scc_find_kosaraju_csr(csr);
+    scc_result_t* graph_result = scc_find_kosaraju(graph);
+    ASSERT_NOT_NULL(csr_result, "CSR Kosaraju가 성공해야 함");
+    ASSERT_NOT_NULL(graph_result, "Kosaraju가 성공해야 함");
+    
+    ASSERT_EQUAL(scc_get_component_count(csr_result), scc_get_component_count(graph_result),
+                 "CSR과 연결 리스트 그래프의 컴포넌트 개수가 같아야 함");
+    for (int i = 0; i < 6; i++) {
+        for (int j = i + 1; j < 6; j++) {
+            int csr_same = (scc_get_vertex_component(csr_result, i) == 
+                            scc_get_vertex_component(csr_result, j));
+            int graph_same = (scc_get_vertex_component(graph_result, i) == 
+                              scc_get_vertex_component(graph_result, j));
+            ASSERT_EQUAL(csr_same, graph_same, "정점 쌍의 컴포넌트 관계가 같아야 함");
+        }
+    }
+    
+    scc_result_destroy(graph_result);
+    scc_result_destroy(csr_result);
+    csr_graph_destroy(csr);
+    graph_destroy(graph);
+    TEST_END();
+}
+
 // 모든 Kosaraju 테스트 실행
+// 깊은 경로 그래프 테스트 (재귀 구현이면 스택 오버플로)
+static void test_kosaraju_deep_path() {
+    TEST_START("Kosaraju algorithm on deep path graph");
+    
+    const int num_vertices = 500000;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+    for (int i = 0; i + 1 < num_vertices; i++) {
+        graph_add_edge(graph, i, i + 1);
+    }
+    
+    scc_result_t* result = scc_find_kosaraju(graph);
+    ASSERT_NOT_NULL(result, "깊은 경로에서도 Kosaraju가 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), num_vertices, "모든 정점이 별도 SCC여야 함");
+    scc_result_destroy(result);
+    
+    // 순환으로 닫으면 두 번째 패스도 한 번에 전체를 탐색해야 함
+    graph_add_edge(graph, num_vertices - 1, 0);
+    result = scc_find_kosaraju(graph);
+    ASSERT_NOT_NULL(result, "순환 경로에서도 Kosaraju가 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 1, "순환 경로는 하나의 SCC여야 함");
+    
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    TEST_END();
+}
+
 void run_kosaraju_tests() {
     printf("=== Kosaraju 알고리즘 테스트 ===\n");
     
@@ -310,6 +393,8 @@ void run_kosaraju_tests() {
     test_kosaraju_performance();
     test_kosaraju_complex_graph();
     test_kosaraju_edge_cases();
+    test_kosaraju_csr();
+    test_kosaraju_deep_path();
     
     printf("Kosaraju 알고리즘 테스트 완료\n\n");
 }
\ No newline at end of file
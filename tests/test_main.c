@@ -43,6 +43,12 @@ int main(int argc, char* argv[]) {
             } else if (strcmp(arg, "performance") == 0) {
                 run_performance_tests();
                 run_specific = true;
+            } else if (strcmp(arg, "parallel") == 0) {
+                run_parallel_tests();
+                run_specific = true;
+            } else if (strcmp(arg, "incremental") == 0) {
+                run_incremental_tests();
+                run_specific = true;
             } else if (strcmp(arg, "all") == 0) {
                 run_all = true;
                 break;
@@ -58,6 +64,8 @@ int main(int argc, char* argv[]) {
                 printf("  io          - 파일 I/O 테스트\n");
                 printf("  integration - 통합 테스트\n");
                 printf("  performance - 성능 벤치마크 테스트\n");
+                printf("  parallel    - 병렬 SCC 엔진 테스트\n");
+                printf("  incremental - 증분 SCC 유지 테스트\n");
                 printf("  all         - 모든 테스트 실행 (기본값)\n");
                 printf("  --help   - 이 도움말 표시\n");
                 return 0;
@@ -87,6 +95,8 @@ int main(int argc, char* argv[]) {
         run_io_tests();
         run_integration_tests();
         run_performance_tests();
+        run_parallel_tests();
+        run_incremental_tests();
     }
     
     // 결과 요약 출력
@@ -0,0 +1,210 @@
+#include "test_framework.h"
+#include "../src/scc_algorithms.h"
+#include "../src/graph.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef SCC_ENABLE_PARALLEL
+
+// 기본 병렬 SCC 테스트
+static void test_parallel_basic() {
+    TEST_START("Parallel FW-BW basic");
+
+    graph_t* graph = graph_create(8);
+    for (int i = 0; i < 8; i++) {
+        graph_add_vertex(graph);
+    }
+
+    // SCC: {0,1,2}, {3,4}, {5}, {6,7}
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 3);
+    graph_add_edge(graph, 4, 5);
+    graph_add_edge(graph, 6, 7);
+    graph_add_edge(graph, 7, 6);
+    graph_add_edge(graph, 7, 0);
+
+    scc_result_t* result = scc_find_parallel(graph, NULL);
+    ASSERT_NOT_NULL(result, "병렬 SCC 찾기가 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 4, "4개의 SCC가 있어야 함");
+
+    // 표준 순서: 가장 작은 정점 순으로 번호가 매겨짐
+    ASSERT_EQUAL(scc_get_vertex_component(result, 0), 0, "정점 0은 컴포넌트 0");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 3), 1, "정점 3은 컴포넌트 1");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 5), 2, "정점 5는 컴포넌트 2");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 6), 3, "정점 6은 컴포넌트 3");
+    ASSERT_EQUAL(scc_get_component_size(result, 0), 3, "첫 SCC 크기가 3이어야 함");
+
+    scc_result_t* tarjan = scc_find_tarjan(graph);
+    ASSERT_TRUE(scc_result_equivalent(result, tarjan), "Tarjan과 같은 분할이어야 함");
+
+    ASSERT_NULL(scc_find_parallel(NULL, NULL), "NULL 그래프는 실패해야 함");
+
+    scc_result_destroy(tarjan);
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 순차 컷오프보다 큰 분할을 만드는 그래프에서 스레드 수별 결과 비교
+static void test_parallel_vs_tarjan() {
+    TEST_START("Parallel FW-BW vs Tarjan on large graph");
+
+    const int num_vertices = 50000;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+
+    // 크기가 다양한 사이클들을 DAG 형태로 연결하고 무작위 간선 추가
+    srand(7);
+    int start = 0;
+    while (start < num_vertices) {
+        int size = 1 + rand() % 200;
+        if (start + size > num_vertices) size = num_vertices - start;
+        for (int i = 0; i + 1 < size; i++) {
+            graph_add_edge(graph, start + i, start + i + 1);
+        }
+        if (size > 1) graph_add_edge(graph, start + size - 1, start);
+        if (start + size < num_vertices) graph_add_edge(graph, start, start + size);
+        start += size;
+    }
+    for (int i = 0; i < num_vertices / 4; i++) {
+        graph_add_edge(graph, rand() % num_vertices, rand() % num_vertices);
+    }
+
+    scc_result_t* tarjan = scc_find_tarjan(graph);
+    ASSERT_NOT_NULL(tarjan, "Tarjan이 성공해야 함");
+
+    scc_parallel_config_t config = scc_parallel_config_default();
+    scc_result_t* first = NULL;
+    for (int threads = 1; threads <= 4; threads++) {
+        config.num_threads = threads;
+        config.use_work_stealing = (threads % 2 == 0);
+        scc_result_t* result = scc_find_parallel(graph, &config);
+        ASSERT_NOT_NULL(result, "병렬 SCC 찾기가 성공해야 함");
+        ASSERT_TRUE(scc_result_equivalent(result, tarjan), "Tarjan과 같은 분할이어야 함");
+
+        // 스레드 수와 무관하게 결과가 동일해야 함
+        if (!first) {
+            first = result;
+        } else {
+            for (int v = 0; v < num_vertices; v++) {
+                if (result->vertex_to_component[v] != first->vertex_to_component[v] ||
+                    result->vertices[v] != first->vertices[v]) {
+                    ASSERT_TRUE(false, "스레드 수와 무관하게 결과가 같아야 함");
+                    break;
+                }
+            }
+            scc_result_destroy(result);
+        }
+    }
+
+    scc_result_destroy(first);
+    scc_result_destroy(tarjan);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 깊은 경로 그래프 (트리밍으로 해소되어야 함)
+static void test_parallel_deep_path() {
+    TEST_START("Parallel FW-BW on deep path graph");
+
+    const int num_vertices = 200000;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+    for (int i = 0; i + 1 < num_vertices; i++) {
+        graph_add_edge(graph, i, i + 1);
+    }
+
+    scc_result_t* result = scc_find_parallel(graph, NULL);
+    ASSERT_NOT_NULL(result, "깊은 경로에서도 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), num_vertices, "모든 정점이 별도 SCC여야 함");
+    scc_result_destroy(result);
+
+    graph_add_edge(graph, num_vertices - 1, 0);
+    result = scc_find_parallel(graph, NULL);
+    ASSERT_NOT_NULL(result, "순환 경로에서도 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 1, "순환 경로는 하나의 SCC여야 함");
+
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 여러 스레드가 같은 const 그래프에서 순차 알고리즘을 동시에 실행
+// 정점에 알고리즘 상태가 없으므로 그래프 복사 없이도 결과가 같아야 함
+static void test_shared_graph_concurrent_find() {
+    TEST_START("Concurrent sequential SCC on a shared graph");
+
+    const int num_vertices = 5000;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+    srand(3);
+    for (int i = 0; i < num_vertices * 2; i++) {
+        graph_add_edge(graph, rand() % num_vertices, rand() % num_vertices);
+    }
+
+    scc_result_t* expected = scc_find_tarjan(graph);
+    ASSERT_NOT_NULL(expected, "Tarjan이 성공해야 함");
+
+    const graph_t* shared = graph;
+    int mismatches = 0;
+    #pragma omp parallel for num_threads(4) reduction(+:mismatches)
+    for (int run = 0; run < 16; run++) {
+        scc_result_t* result = (run % 2) ? scc_find_kosaraju(shared) : scc_find_tarjan(shared);
+        if (!result || !scc_result_equivalent(result, expected)) mismatches++;
+        scc_result_destroy(result);
+    }
+    ASSERT_EQUAL(mismatches, 0, "모든 스레드가 같은 분할을 얻어야 함");
+
+    scc_result_destroy(expected);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 잘못된 설정 테스트
+static void test_parallel_invalid_config() {
+    TEST_START("Parallel FW-BW invalid config");
+
+    graph_t* graph = graph_create(2);
+    graph_add_vertex(graph);
+    graph_add_vertex(graph);
+
+    scc_parallel_config_t config = scc_parallel_config_default();
+    config.num_threads = -1;
+    ASSERT_NULL(scc_find_parallel(graph, &config), "음수 스레드 수는 실패해야 함");
+    ASSERT_EQUAL(scc_get_last_error(), SCC_ERROR_INVALID_PARAMETER, "INVALID_PARAMETER 오류여야 함");
+
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 모든 병렬 테스트 실행
+void run_parallel_tests() {
+    printf("=== 병렬 SCC 엔진 테스트 ===\n");
+
+    test_parallel_basic();
+    test_parallel_vs_tarjan();
+    test_parallel_deep_path();
+    test_shared_graph_concurrent_find();
+    test_parallel_invalid_config();
+
+    printf("병렬 SCC 엔진 테스트 완료\n\n");
+}
+
+#else
+
+void run_parallel_tests() {
+    printf("=== 병렬 SCC 엔진 테스트 ===\n");
+    printf("SCC_ENABLE_PARALLEL이 꺼져 있어 건너뜀\n\n");
+}
+
+#endif // SCC_ENABLE_PARALLEL
@@ -53,21 +53,10 @@ static graph_t* create_complete_graph(int size) {
     return graph;
 }
 
+// 같은 기대 간선 수의 G(n, m)을 고정 시드로 생성 (O(V²) 순회 없이, 실행마다 같은 그래프)
 static graph_t* create_random_graph(int size, double edge_probability) {
-    graph_t* graph = graph_create(size);
-    for (int i = 0; i < size; i++) {
-        graph_add_vertex(graph);
-    }
-    
-    srand((unsigned int)time(NULL));
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            if (i != j && (double)rand() / RAND_MAX < edge_probability) {
-                graph_add_edge(graph, i, j);
-            }
-        }
-    }
-    return graph;
+    int num_edges = (int)(edge_probability * size * (size - 1));
+    return graph_generate_erdos_renyi(size, num_edges, 42);
 }
 
 static graph_t* create_multi_component_graph(int components, int component_size) {
@@ -119,8 +108,8 @@ static benchmark_result_t benchmark_algorithm(
         // 메모리 사용량 추정 (실제 측정은 복잡하므로 근사치)
         int vertices = graph_get_vertex_count(graph);
         result.memory_bytes = sizeof(scc_result_t) + 
-                             result.result_components * sizeof(scc_component_t) +
-                             vertices * sizeof(int); // vertex_to_component
+                             (result.result_components + 1) * sizeof(int) + // component_offsets
+                             2 * vertices * sizeof(int); // vertices, vertex_to_component
         
         scc_result_destroy(scc_result);
     }
@@ -1,7 +1,9 @@
 #include "test_framework.h"
 #include "../src/scc.h"
 #include "../src/graph.h"
+#include "../src/scc_algorithms.h"
 #include <assert.h>
+#include <string.h>
 
 // 간단한 SCC 테스트 (단일 컴포넌트)
 static void test_single_component() {
@@ -201,6 +203,176 @@ static void test_scc_result_copy() {
     TEST_END();
 }
 
+// 바이너리 결과 파일 저장 및 매핑 로드 테스트
+static void test_scc_result_save_load() {
+    TEST_START("SCC result binary save and load");
+    
+    graph_t* graph = graph_create(6);
+    for (int i = 0; i < 6; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    // SCC: {0,1,2}, {3,4}, {5}
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 3);
+    graph_add_edge(graph, 4, 5);
+    
+    scc_result_t* original = scc_find(graph);
+    ASSERT_NOT_NULL(original, "SCC 찾기가 성공해야 함");
+    
+    const char* filename = "temp_test_scc_result.bin";
+    ASSERT_EQUAL(scc_result_save(original, filename), SCC_SUCCESS, "결과 저장이 성공해야 함");
+    
+    scc_result_t* loaded = scc_result_load(filename);
+    ASSERT_NOT_NULL(loaded, "결과 로드가 성공해야 함");
+    ASSERT_NOT_NULL(loaded->mapping, "로드된 결과는 파일 매핑을 사용해야 함");
+    ASSERT_EQUAL(scc_get_component_count(loaded), 3, "컴포넌트 개수가 같아야 함");
+    ASSERT_EQUAL(loaded->largest_component_size, original->largest_component_size, "통계가 같아야 함");
+    for (int v = 0; v < 6; v++) {
+        ASSERT_EQUAL(scc_get_vertex_component(loaded, v), scc_get_vertex_component(original, v),
+                     "정점의 컴포넌트가 같아야 함");
+    }
+    for (int c = 0; c < 3; c++) {
+        ASSERT_EQUAL(scc_get_component_size(loaded, c), scc_get_component_size(original, c),
+                     "컴포넌트 크기가 같아야 함");
+        ASSERT_TRUE(memcmp(scc_get_component_vertices(loaded, c), scc_get_component_vertices(original, c),
+                           scc_get_component_size(original, c) * sizeof(int)) == 0,
+                    "컴포넌트 정점이 같아야 함");
+    }
+    
+    // 매핑된 결과도 복사하면 일반 결과가 됨
+    scc_result_t* copy = scc_result_copy(loaded);
+    ASSERT_NOT_NULL(copy, "매핑된 결과 복사가 성공해야 함");
+    ASSERT_NULL(copy->mapping, "복사본은 매핑을 쓰지 않아야 함");
+    scc_result_destroy(copy);
+    scc_result_destroy(loaded);
+    
+    // 구획 위치 계산이 넘치도록 조작한 헤더는 거부
+    // (헤더 배치: num_vertices@24, vertex_to_component_pos@64, offsets_pos@72, vertices_pos@80)
+    int64_t num_vertices = 1030;
+    uint64_t positions[3] = { UINT64_MAX - 4095, 4096, 8192 };  // 첫 구획 끝이 24로 넘침
+    FILE* file = fopen(filename, "r+b");
+    fseek(file, 24, SEEK_SET);
+    fwrite(&num_vertices, sizeof(num_vertices), 1, file);
+    fseek(file, 64, SEEK_SET);
+    fwrite(positions, sizeof(positions), 1, file);
+    fclose(file);
+    ASSERT_NULL(scc_result_load(filename), "넘치는 구획 위치는 실패해야 함");
+    ASSERT_EQUAL(scc_result_save(original, filename), SCC_SUCCESS, "결과 저장이 성공해야 함");
+    
+    // 잘못된 파일은 거부
+    file = fopen(filename, "r+b");
+    fputc('X', file);
+    fclose(file);
+    ASSERT_NULL(scc_result_load(filename), "잘못된 매직 넘버는 실패해야 함");
+    ASSERT_EQUAL(scc_get_last_error(), SCC_ERROR_INVALID_PARAMETER, "INVALID_PARAMETER 오류여야 함");
+    ASSERT_NULL(scc_result_load("nonexistent_result.bin"), "존재하지 않는 파일은 실패해야 함");
+    ASSERT_EQUAL(scc_result_save(NULL, filename), SCC_ERROR_NULL_POINTER, "NULL 결과는 실패해야 함");
+    
+    remove(filename);
+    scc_result_destroy(original);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 평탄화된 결과 레이아웃 테스트
+static void test_scc_result_layout() {
+    TEST_START("SCC result flat layout");
+
+    graph_t* graph = graph_create(5);
+    for (int i = 0; i < 5; i++) {
+        graph_add_vertex(graph);
+    }
+
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+
+    scc_result_t* result = scc_find(graph);
+    ASSERT_NOT_NULL(result, "SCC 찾기가 성공해야 함");
+    ASSERT_EQUAL(3, result->num_components, "3개의 SCC가 있어야 함");
+    ASSERT_EQUAL(0, result->component_offsets[0], "첫 오프셋은 0이어야 함");
+    ASSERT_EQUAL(5, result->component_offsets[result->num_components],
+                 "마지막 오프셋은 정점 수와 같아야 함");
+
+    // vertices 배열은 정점의 순열이며 각 정점은 자기 컴포넌트 구간에 위치
+    int seen[5] = {0};
+    for (int c = 0; c < result->num_components; c++) {
+        int size = scc_get_component_size(result, c);
+        const int* members = scc_get_component_vertices(result, c);
+        ASSERT_EQUAL(result->component_offsets[c + 1] - result->component_offsets[c], size,
+                     "컴포넌트 크기는 오프셋 차이와 같아야 함");
+        for (int i = 0; i < size; i++) {
+            ASSERT_EQUAL(c, scc_get_vertex_component(result, members[i]),
+                         "정점은 자기 컴포넌트 구간에 있어야 함");
+            seen[members[i]]++;
+        }
+    }
+    for (int v = 0; v < 5; v++) {
+        ASSERT_EQUAL(1, seen[v], "각 정점은 정확히 한 번 나타나야 함");
+    }
+
+    scc_result_destroy(result);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 재사용 컨텍스트 테스트: 크기가 다른 그래프를 번갈아 계산
+static void test_scc_context_reuse() {
+    TEST_START("Reusable SCC context");
+
+    graph_t* small = graph_create(4);
+    for (int i = 0; i < 4; i++) {
+        graph_add_vertex(small);
+    }
+    graph_add_edge(small, 0, 1);
+    graph_add_edge(small, 1, 0);
+    graph_add_edge(small, 2, 3);
+
+    graph_t* large = graph_create(100);
+    for (int i = 0; i < 100; i++) {
+        graph_add_vertex(large);
+    }
+    for (int i = 0; i < 100; i++) {
+        graph_add_edge(large, i, (i + 1) % 50 + (i / 50) * 50);  // 50개짜리 사이클 두 개
+    }
+
+    scc_context_t* ctx = scc_context_create(0);
+    ASSERT_NOT_NULL(ctx, "컨텍스트 생성이 성공해야 함");
+
+    for (int round = 0; round < 2; round++) {
+        const scc_result_t* result = scc_find_tarjan_ctx(small, ctx);
+        ASSERT_NOT_NULL(result, "작은 그래프 계산이 성공해야 함");
+        ASSERT_EQUAL(scc_get_component_count(result), 3, "작은 그래프는 3개의 SCC");
+        ASSERT_EQUAL(result->num_vertices, 4, "정점 수가 현재 그래프와 같아야 함");
+
+        result = scc_find_kosaraju_ctx(large, ctx);
+        ASSERT_NOT_NULL(result, "큰 그래프 계산이 성공해야 함");
+        ASSERT_EQUAL(scc_get_component_count(result), 2, "큰 그래프는 2개의 SCC");
+        ASSERT_EQUAL(scc_get_component_size(result, 0), 50, "각 SCC는 50개 정점");
+
+        csr_graph_t* csr = graph_freeze(small);
+        result = scc_find_kosaraju_csr_ctx(csr, ctx);
+        ASSERT_EQUAL(scc_get_component_count(result), 3, "CSR 경로도 같은 결과여야 함");
+        result = scc_find_tarjan_csr_ctx(csr, ctx);
+        ASSERT_EQUAL(scc_get_component_count(result), 3, "CSR 경로도 같은 결과여야 함");
+        csr_graph_destroy(csr);
+    }
+
+    ASSERT_NULL(scc_find_tarjan_ctx(NULL, ctx), "NULL 그래프는 실패해야 함");
+
+    scc_context_destroy(ctx);
+    graph_destroy(large);
+    graph_destroy(small);
+    TEST_END();
+}
+
 // 강한 연결성 확인 테스트
 static void test_is_strongly_connected() {
     TEST_START("Strong connectivity check");
@@ -279,6 +451,169 @@ static void test_condensation_graph() {
     TEST_END();
 }
 
+// 번호만 다른 분할은 같고, 정점 하나라도 옮기면 달라야 함
+static void test_scc_result_equivalent() {
+    TEST_START("SCC result partition equivalence");
+    
+    graph_t* graph = graph_create(6);
+    for (int i = 0; i < 6; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    // SCC: {0,1,2}, {3,4}, {5}
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 3);
+    graph_add_edge(graph, 4, 5);
+    
+    scc_result_t* tarjan = scc_find_tarjan(graph);
+    scc_result_t* kosaraju = scc_find_kosaraju(graph);
+    ASSERT_TRUE(scc_result_equivalent(tarjan, kosaraju), "Tarjan and Kosaraju should give the same partition");
+    
+    // 컴포넌트 번호 뒤집기
+    scc_result_t* relabelled = scc_result_copy(tarjan);
+    for (int v = 0; v < 6; v++) {
+        relabelled->vertex_to_component[v] = 2 - relabelled->vertex_to_component[v];
+    }
+    ASSERT_TRUE(scc_result_equivalent(tarjan, relabelled), "Relabelled components should be equivalent");
+    
+    // 정점 5를 {3,4}로 옮기고 {0,1,2}를 둘로 나눠 컴포넌트 수는 유지
+    relabelled->vertex_to_component[5] = relabelled->vertex_to_component[3];
+    relabelled->vertex_to_component[0] = 2 - tarjan->vertex_to_component[5];
+    ASSERT_FALSE(scc_result_equivalent(tarjan, relabelled), "A different partition should not be equivalent");
+    
+    scc_result_destroy(relabelled);
+    scc_result_destroy(kosaraju);
+    scc_result_destroy(tarjan);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 벤치마크: 반복 통계, 실제 DFS 깊이, 계측 할당기로 잰 메모리
+static void test_benchmark_measurements() {
+    TEST_START("Algorithm benchmark measurements");
+    
+    // 계측 할당기는 요청 크기를 정확히 셈
+    size_t before = scc_memory_current_bytes();
+    void* block = scc_malloc(1000);
+    ASSERT_EQUAL((int)(scc_memory_current_bytes() - before), 1000, "Live bytes should grow by the request");
+    ASSERT_TRUE(scc_memory_peak_bytes() >= before + 1000, "Peak should cover the live bytes");
+    block = scc_realloc(block, 4000);
+    ASSERT_EQUAL((int)(scc_memory_current_bytes() - before), 4000, "Realloc should adjust live bytes");
+    scc_free(block);
+    ASSERT_EQUAL((int)(scc_memory_current_bytes() - before), 0, "Free should release the bytes");
+    
+    // 경로 그래프: DFS 깊이가 정점 수와 같음
+    const int n = 200;
+    graph_t* graph = graph_create(n);
+    graph_add_vertices(graph, n);
+    for (int i = 0; i + 1 < n; i++) {
+        graph_add_edge(graph, i, i + 1);
+    }
+    
+    scc_benchmark_result_t* benchmark = scc_benchmark_algorithms_repeat(graph, 7);
+    ASSERT_NOT_NULL(benchmark, "Benchmark should succeed");
+    ASSERT_EQUAL(benchmark->repetitions, 7, "Repetition count should be recorded");
+    ASSERT_EQUAL(benchmark->tarjan_stack_max_depth, n, "DFS depth of a path should be its length");
+    ASSERT_TRUE(benchmark->results_match, "Both algorithms should give the same partition");
+    ASSERT_TRUE(benchmark->tarjan_timing.min_ms <= benchmark->tarjan_timing.median_ms &&
+                benchmark->tarjan_timing.median_ms <= benchmark->tarjan_timing.p99_ms &&
+                benchmark->tarjan_timing.p99_ms <= benchmark->tarjan_timing.max_ms,
+                "Timing statistics should be ordered");
+    ASSERT_TRUE(benchmark->tarjan_time_ms == benchmark->tarjan_timing.median_ms, "Reported time should be the median");
+    // 결과 배열만으로도 정점당 12바이트 이상
+    ASSERT_TRUE(benchmark->tarjan_memory_peak_bytes >= (size_t)n * 12, "Tarjan peak should include its result");
+    ASSERT_TRUE(benchmark->kosaraju_memory_peak_bytes > benchmark->tarjan_memory_peak_bytes,
+                "Kosaraju peak should include the transpose");
+    
+    // 하드웨어 카운터: 열 수 없으면 무효로 남고, 열리면 실제 실행을 셈
+    for (int i = 0; i < SCC_HW_COUNTER_COUNT; i++) {
+        ASSERT_TRUE(benchmark->tarjan_counters.valid[i] || benchmark->tarjan_counters.values[i] == 0,
+                    "Unavailable counters should stay zero");
+    }
+    if (benchmark->tarjan_counters.valid[SCC_HW_INSTRUCTIONS]) {
+        ASSERT_TRUE(benchmark->tarjan_counters.values[SCC_HW_INSTRUCTIONS] > 0, "Runs should retire instructions");
+    }
+    scc_hw_counters_t sample;
+    memset(&sample, 0, sizeof(sample));
+    scc_perf_counters_start(NULL);
+    scc_perf_counters_stop(NULL, &sample);
+    ASSERT_FALSE(sample.valid[SCC_HW_CYCLES], "A missing counter set should measure nothing");
+    ASSERT_TRUE(strcmp(scc_hw_counter_name(SCC_HW_LLC_MISSES), "llc_misses") == 0, "Counter names are stable");
+    scc_benchmark_result_destroy(benchmark);
+    
+    ASSERT_NULL(scc_benchmark_algorithms_repeat(graph, 0), "Zero repetitions should be rejected");
+    
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 단계별 통계: 프로파일링 빌드에서는 카운터가 정확해야 하고, 아니면 0으로 채워짐
+static void test_scc_stats() {
+    TEST_START("Per-phase SCC statistics");
+    
+    // 경로 0 -> 1 -> ... -> n-1 과 되돌아가는 간선 n-1 -> n/2
+    const int n = 100;
+    graph_t* graph = graph_create(n);
+    graph_add_vertices(graph, n);
+    for (int i = 0; i + 1 < n; i++) {
+        graph_add_edge(graph, i, i + 1);
+    }
+    graph_add_edge(graph, n - 1, n / 2);
+    int num_edges = graph_get_edge_count(graph);
+    csr_graph_t* csr = graph_freeze(graph);
+    
+    scc_stats_t tarjan_stats, kosaraju_stats, csr_stats;
+    scc_result_t* tarjan = scc_find_tarjan_stats(graph, &tarjan_stats);
+    scc_result_t* kosaraju = scc_find_kosaraju_stats(graph, &kosaraju_stats);
+    scc_result_t* tarjan_csr = scc_find_tarjan_csr_stats(csr, &csr_stats);
+    scc_result_t* kosaraju_csr = scc_find_kosaraju_csr_stats(csr, NULL);
+    
+    ASSERT_NOT_NULL(tarjan, "Tarjan with stats should succeed");
+    ASSERT_EQUAL(tarjan->num_components, n / 2 + 1, "Path plus one back edge");
+    ASSERT_TRUE(scc_result_equivalent(tarjan, kosaraju), "Kosaraju with stats should agree");
+    ASSERT_TRUE(scc_result_equivalent(tarjan, tarjan_csr), "CSR Tarjan with stats should agree");
+    ASSERT_TRUE(scc_result_equivalent(tarjan, kosaraju_csr), "NULL stats should be accepted");
+    
+    if (tarjan_stats.enabled) {
+        ASSERT_EQUAL((int)tarjan_stats.edges_scanned, num_edges, "Tarjan scans every edge once");
+        ASSERT_EQUAL((int)tarjan_stats.stack_pushes, n, "Tarjan pushes one frame per vertex");
+        ASSERT_EQUAL(tarjan_stats.max_dfs_depth, n, "DFS depth of a path is its length");
+        ASSERT_TRUE(tarjan_stats.allocations > 0 && tarjan_stats.bytes_allocated > 0,
+                    "State and result allocations should be counted");
+        ASSERT_EQUAL((int)tarjan_stats.vertices_extracted, n, "Tarjan pops every vertex into a component once");
+        ASSERT_TRUE(tarjan_stats.tarjan_dfs_ms >= 0.0, "Phase times should not be negative");
+        ASSERT_TRUE(tarjan_stats.total_ms >= tarjan_stats.tarjan_dfs_ms, "Total should cover the phases");
+        ASSERT_TRUE(tarjan_stats.kosaraju_first_pass_ms == 0.0, "Tarjan has no Kosaraju phases");
+        
+        ASSERT_EQUAL((int)kosaraju_stats.edges_scanned, 2 * num_edges, "Kosaraju scans the graph and its transpose");
+        ASSERT_EQUAL((int)kosaraju_stats.stack_pushes, 2 * n, "Kosaraju pushes every vertex in both passes");
+        ASSERT_EQUAL(kosaraju_stats.max_dfs_depth, n, "First pass depth of a path is its length");
+        ASSERT_TRUE(kosaraju_stats.allocations > tarjan_stats.allocations, "The transpose adds allocations");
+        ASSERT_TRUE(kosaraju_stats.tarjan_dfs_ms == 0.0, "Kosaraju has no Tarjan phase");
+        ASSERT_EQUAL((int)kosaraju_stats.vertices_extracted, 0, "Kosaraju does not use the Tarjan stack");
+        
+        ASSERT_EQUAL((int)csr_stats.edges_scanned, num_edges, "CSR Tarjan scans every edge once");
+        ASSERT_EQUAL(csr_stats.max_dfs_depth, n, "CSR DFS depth of a path is its length");
+        ASSERT_EQUAL((int)csr_stats.vertices_extracted, n, "CSR Tarjan pops every vertex once");
+    } else {
+        ASSERT_TRUE(tarjan_stats.edges_scanned == 0 && tarjan_stats.total_ms == 0.0,
+                    "Stats should be zeroed without SCC_ENABLE_PROFILING");
+        ASSERT_FALSE(kosaraju_stats.enabled, "Profiling is a build-wide setting");
+    }
+    
+    scc_result_destroy(kosaraju_csr);
+    scc_result_destroy(tarjan_csr);
+    scc_result_destroy(kosaraju);
+    scc_result_destroy(tarjan);
+    csr_graph_destroy(csr);
+    graph_destroy(graph);
+    TEST_END();
+}
+
 // 모든 SCC 테스트 실행
 void run_scc_tests() {
     printf("=== SCC 모듈 테스트 ===\n");
@@ -289,8 +624,14 @@ void run_scc_tests() {
     test_self_loops();
     test_empty_graph();
     test_scc_result_copy();
+    test_scc_result_layout();
+    test_scc_result_save_load();
+    test_scc_result_equivalent();
+    test_scc_context_reuse();
     test_is_strongly_connected();
     test_condensation_graph();
+    test_benchmark_measurements();
+    test_scc_stats();
     
     printf("SCC 모듈 테스트 완료\n\n");
 }
\ No newline at end of file
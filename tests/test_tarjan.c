@@ -237,6 +237,89 @@ static void test_tarjan_edge_cases() {
     TEST_END();
 }
 
+// CSR 그래프에서 Tarjan 테스트
+static void test_tarjan_csr() {
+    TEST_START("Tarjan algorithm on frozen CSR graph");
+    
+    graph_t* graph = graph_create(6);
+    for (int i = 0; i < 6; i++) {
+        graph_add_vertex(graph);
+    }
+    
+    // SCC: {0,1,2}, {3,4}, {5}
+    graph_add_edge(graph, 0, 1);
+    graph_add_edge(graph, 1, 2);
+    graph_add_edge(graph, 2, 0);
+    graph_add_edge(graph, 2, 3);
+    graph_add_edge(graph, 3, 4);
+    graph_add_edge(graph, 4, 3);
+    graph_add_edge(graph, 4, 5);
+    
+    csr_graph_t* csr = graph_freeze(graph);
+    ASSERT_NOT_NULL(csr, "CSR 고정이 성공해야 함");
+    
+    scc_result_t* result = scc_find_tarjan_csr(csr);
+    ASSERT_NOT_NULL(result, "CSR Tarjan이 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), 3, "3개의 SCC가 있어야 함");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 0), scc_get_vertex_component(result, 2),
+                 "정점 0과 2가 같은 컴포넌트에 속해야 함");
+    ASSERT_EQUAL(scc_get_vertex_component(result, 3), scc_get_vertex_component(result, 4),
+                 "정점 3과 4가 같은 컴포넌트에 속해야 함");
+    ASSERT_NOT_EQUAL(scc_get_vertex_component(result, 2), scc_get_vertex_component(result, 3),
+                     "정점 2와 3이 다른 컴포넌트에 속해야 함");
+    
+    ASSERT_NULL(scc_find_tarjan_csr(NULL), "NULL CSR 그래프는 실패해야 함");
+    
+    scc_result_destroy(result);
+    csr_graph_destroy(csr);
+    graph_destroy(graph);
+    TEST_END();
+}
+
+// 깊은 경로 그래프 테스트 (재귀 구현이면 스택 오버플로)
+// SCC_STRESS_TESTS로 빌드하면 1000만 정점 경로로 실행
+#ifdef SCC_STRESS_TESTS
+#define TARJAN_DEEP_PATH_VERTICES 10000000
+#else
+#define TARJAN_DEEP_PATH_VERTICES 500000
+#endif
+
+static void test_tarjan_deep_path() {
+    TEST_START("Tarjan algorithm on deep path graph");
+    
+    const int num_vertices = TARJAN_DEEP_PATH_VERTICES;
+    graph_t* graph = graph_create(num_vertices);
+    for (int i = 0; i < num_vertices; i++) {
+        graph_add_vertex(graph);
+    }
+    for (int i = 0; i + 1 < num_vertices; i++) {
+        graph_add_edge(graph, i, i + 1);
+    }
+    
+    scc_result_t* result = scc_find_tarjan(graph);
+    ASSERT_NOT_NULL(result, "깊은 경로에서도 Tarjan이 성공해야 함");
+    ASSERT_EQUAL(scc_get_component_count(result), num_vertices, "모든 정점이 별도 SCC여야 함");
+    scc_result_destroy(result);
+    
+    // 마지막 정점에서 처음으로 돌아가는 간선을 추가하면 하나의 SCC
+    graph_add_edge(graph, num_vertices - 1, 0);
+    
+    // 같은 상태를 여러 번 재사용
+    tarjan_state_t* state = tarjan_state_create(num_vertices);
+    ASSERT_NOT_NULL(state, "상태 생성이 성공해야 함");
+    for (int run = 0; run < 2; run++) {
+        result = scc_tarjan_internal(graph, state);
+        ASSERT_NOT_NULL(result, "상태 재사용 시에도 성공해야 함");
+        ASSERT_EQUAL(scc_get_component_count(result), 1, "순환 경로는 하나의 SCC여야 함");
+        ASSERT_EQUAL(scc_get_component_size(result, 0), num_vertices, "SCC 크기가 정점 수와 같아야 함");
+        scc_result_destroy(result);
+    }
+    
+    tarjan_state_destroy(state);
+    graph_destroy(graph);
+    TEST_END();
+}
+
 // 모든 Tarjan 테스트 실행
 void run_tarjan_tests() {
     printf("=== Tarjan 알고리즘 테스트 ===\n");
@@ -247,6 +330,8 @@ void run_tarjan_tests() {
     test_tarjan_complex_graph();
     test_tarjan_performance();
     test_tarjan_edge_cases();
+    test_tarjan_csr();
+    test_tarjan_deep_path();
     
     printf("Tarjan 알고리즘 테스트 완료\n\n");
 }
\ No newline at end of file